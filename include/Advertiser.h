@@ -0,0 +1,39 @@
+#ifndef ADVERTISER_H
+#define ADVERTISER_H
+
+#include <Arduino.h>
+#include <BLEDevice.h>
+
+// Advertising intervals in 0.625 ms units
+#define ADV_FAST_MIN 32       // 20 ms
+#define ADV_FAST_MAX 48       // 30 ms
+#define ADV_SLOW_MIN 668      // 417.5 ms
+#define ADV_SLOW_MAX 874      // 546.25 ms
+#define ADV_BROADCAST_MIN 160 // 100 ms, the shortest allowed for scannable advertising
+#define ADV_BROADCAST_MAX 192 // 120 ms
+#define ADV_FAST_MS 30000     // Length of the fast burst
+
+// Owns the advertising and scan response data.
+//
+// Advertises fast for ADV_FAST_MS after boot and after every disconnect,
+// so a phone that just lost the glove finds it again within a few tens of
+// milliseconds, then backs off to the slow interval to save power.
+// Connectable advertising goes on at the slow interval while there is room
+// for another central (see Sessions.h) and stops once every slot is taken.
+//
+// In broadcast mode the advertising data carries the latest letters (see
+// BroadcastFormat.h) instead of the service UUID, which moves to the scan
+// response. With every session slot taken the glove keeps advertising them,
+// scannable but not connectable, so other receivers can follow along.
+//
+// Not locked: call everything from setup() and loop() only, BLE callbacks
+// hand connects, disconnects and commands over as events (AppEvents.h).
+void advertiserBegin(BLEUUID service, const char *name, uint16_t minConnInterval, uint16_t maxConnInterval);
+void advertiserStartFast();
+void advertiserConnected(bool full);                      // Connectable advertising stops once no slot is left
+void advertiserDisconnected();                            // A slot opened, advertise fast again
+void advertiserUpdate();                                  // Call from loop(), switches to slow when the burst is over
+void advertiserSetBroadcast(bool enabled);
+void advertiserBroadcast(const char *text, size_t length); // New letters, sent on air when broadcasting
+
+#endif
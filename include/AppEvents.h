@@ -0,0 +1,49 @@
+#ifndef APP_EVENTS_H
+#define APP_EVENTS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "MessageHistory.h"
+
+#define APP_EVENT_QUEUE_LEN 16
+#define APP_TEXT_SLOTS 4 // Texts received but not yet taken by loop()
+
+// Everything loop() reacts to that does not come from polling
+enum AppEventType
+{
+  EVENT_BUTTON_SHORT,  // Press and release, no second press followed
+  EVENT_BUTTON_DOUBLE, // Two short presses in quick succession
+  EVENT_BUTTON_LONG,   // Held down past the long press time
+  EVENT_SET_RATE,      // App command, arg is the connection id << 16 | frame interval in ms
+  EVENT_SET_MODE,      // App command, arg is the DisplayView to switch to
+  EVENT_CALIBRATE,     // App command
+  EVENT_QUERY_STATS,   // App command, arg is the connection id to reply to
+  EVENT_LETTER,        // A letter arrived in text slot arg, show it and forward it to the letter subscribers
+  EVENT_RECORD,        // App command, arg 1 starts and 0 stops the flash recorder
+  EVENT_TEXT,          // App command, text to show is in slot arg
+  EVENT_CONNECTED,     // A central connected, arg 1 when it is the only one
+  EVENT_DISCONNECTED,  // A central disconnected, arg is the number still connected
+  EVENT_SUBSCRIBE,     // App command, arg is the connection id << 16 | StreamMask
+  EVENT_SET_BROADCAST  // App command, arg 1 puts the letters in the advertising data, 0 stops it
+};
+
+struct AppEvent
+{
+  AppEventType type;
+  int32_t arg;
+};
+
+void appEventsBegin();                                  // Create the queue, call once from setup()
+bool postEvent(AppEventType type, int32_t arg = 0); // From tasks, never blocks
+bool nextEvent(AppEvent *event);                    // Non-blocking, false when the queue is empty
+bool waitEvent(AppEvent *event, uint32_t timeoutUs); // Sleeps until an event or the timeout, rounded up to a tick
+
+// Text from the BLE task is copied into a fixed slot, truncated like the
+// history, and the slot index travels in the event. loop() reads the text
+// and releases the slot; until then the slot is not reused.
+bool postText(AppEventType type, const char *text, size_t length); // False when every slot is taken or the queue is full
+const char *eventText(const AppEvent &event, size_t *length);
+void releaseText(const AppEvent &event);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef BULK_DOWNLOAD_H
+#define BULK_DOWNLOAD_H
+
+#include <Arduino.h>
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <esp_gatts_api.h>
+
+#define BULK_MAX_IN_FLIGHT 10 // Notifications handed to the stack and not confirmed yet
+#define BULK_PUMP_MS 2        // How often the task tops up the stack while a download runs
+#define BULK_REQUEST_QUEUE 4  // Requests from centrals, on top of one slot per session kept for disconnects
+
+// Serves recordings (see Recorder.h) over the bulk characteristic with the
+// windowed protocol in lib/BulkTransfer/BulkTransfer.h. Chunks fill the
+// whole MTU and a task keeps the controller's queue topped up, so a download
+// runs at what the link can carry instead of one notification per interval.
+// One central downloads at a time, and only once it enabled notifications
+// on the bulk characteristic. A disconnect always reaches the bulk task, in
+// order behind the requests of that connection, so a download never carries
+// on to a later central that is given the same connection id.
+void bulkBegin(BLEServer *server, BLECharacteristic *bulk);
+void bulkWrite(uint16_t connId, const uint8_t *data, size_t length); // From the characteristic's onWrite
+void bulkDisconnected(uint16_t connId);
+
+// Notification completion and congestion, call from the custom GATT server handler
+void bulkGattsEvent(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf, esp_ble_gatts_cb_param_t *param);
+
+#endif
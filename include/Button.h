@@ -0,0 +1,16 @@
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include <Arduino.h>
+
+#define BUTTON_DEBOUNCE_MS 25  // Input must be quiet this long before a level counts
+#define BUTTON_LONG_MS 800     // Held at least this long is a long press
+#define BUTTON_DOUBLE_MS 300   // Second press must start within this after the first release
+
+// Interrupt driven push button (active LOW).
+// The ISR only wakes a small task, which debounces the input and runs the
+// press state machine, posting EVENT_BUTTON_SHORT / _DOUBLE / _LONG to the app event queue.
+// Nothing here ever blocks loop().
+void buttonBegin(int pin);
+
+#endif
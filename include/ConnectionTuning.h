@@ -0,0 +1,76 @@
+#ifndef CONNECTION_TUNING_H
+#define CONNECTION_TUNING_H
+
+#include <Arduino.h>
+#include <BLEDevice.h>
+#include <BLESecurity.h>
+#include <esp_gap_ble_api.h>
+
+#define CONNECTION_MTU 247         // Local MTU offered in the exchange, fills one 251 byte LL packet
+#define CONNECTION_DATA_LENGTH 251 // Data length extension, largest LL payload
+#define CONNECTION_INFO_WIRE_SIZE 24
+#define CONNECTION_PEER_HISTORY 8  // Centrals whose last disconnect is remembered for the reconnect time
+
+struct Session; // Sessions.h
+
+// Connection parameter sets the app can pick from, intervals in 1.25 ms units, timeout in 10 ms units
+enum ConnectionProfile : uint8_t
+{
+  PROFILE_LOW_LATENCY, // 7.5-15 ms, every event, for streaming frames
+  PROFILE_BALANCED,    // 30-50 ms
+  PROFILE_LOW_POWER,   // 100-200 ms, peripheral may skip 4 events
+  PROFILE_COUNT
+};
+
+struct ConnectionParams
+{
+  uint16_t minInterval;
+  uint16_t maxInterval;
+  uint16_t latency;
+  uint16_t timeout;
+};
+
+// What one central actually agreed to, filled in from the GAP events as they arrive
+struct ConnectionInfo
+{
+  ConnectionProfile requested;
+  uint16_t interval; // 1.25 ms units, 0 until the first update completes
+  uint16_t latency;
+  uint16_t timeout;  // 10 ms units
+  uint16_t txOctets; // LL payload, 27 without data length extension
+  uint16_t rxOctets;
+  uint16_t mtu;
+  uint8_t txPhy;     // 1 = 1M, 2 = 2M, 3 = coded
+  uint8_t rxPhy;
+  bool encrypted;       // Link encrypted with bonded (or freshly exchanged) keys
+  uint32_t reconnectMs; // This central's last disconnect to this connect, 0 on its first connect
+  uint16_t securedMs;   // Connect to encryption complete on the current link
+  uint16_t reconnects;  // Of this central since boot
+  uint32_t connectedAt; // millis() of the connect, not sent
+};
+
+// Every central's info lives in its Session (Sessions.h), the GAP events are matched to it by address.
+//
+// After connecting, ask for the given profile, data length extension and,
+// where the controller has BLE 5, the 2M PHY. Results come back through
+// GAP events and end up in the session's ConnectionInfo; the central may
+// refuse or pick other values. Call connectionTuningBegin() once before advertising.
+//
+// The link is encrypted with "just works" bonding, keys are kept in NVS by
+// the stack, so a returning phone skips pairing and reuses its cached GATT
+// table. The time from a disconnect to the next secured link is measured.
+// A bonded central that had TX or bulk notifications on when it disconnected
+// gets them back as soon as its link is encrypted again, as GATT requires
+// for bonded peers, without writing the CCCDs.
+void connectionTuningBegin();
+void connectionTuningConnected(const esp_bd_addr_t peer, ConnectionInfo &info, ConnectionProfile profile);
+bool connectionRequestProfile(const esp_bd_addr_t peer, ConnectionInfo &info, ConnectionProfile profile);
+void connectionTuningDisconnected(const esp_bd_addr_t peer, const Session *session); // Its session, NULL if none
+
+const ConnectionParams &connectionParams(ConnectionProfile profile);
+
+// requested profile, interval, latency, timeout, tx/rx octets, mtu (LE uint16 except profile), tx/rx PHY,
+// encrypted, reconnect ms (u32), secured ms, reconnect count
+size_t serializeConnectionInfo(const ConnectionInfo &info, uint8_t *out, size_t capacity);
+
+#endif
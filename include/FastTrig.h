@@ -0,0 +1,65 @@
+#ifndef FAST_TRIG_H
+#define FAST_TRIG_H
+
+#include <stdint.h>
+
+// Integer sine/cosine for UI drawing, angles in whole degrees, results in Q15.
+// The quarter-wave table is built at compile time, nothing is computed at runtime.
+
+#define TRIG_ONE 32767 // 1.0 in Q15
+
+namespace fasttrig
+{
+  constexpr double PI_DOUBLE = 3.14159265358979323846;
+
+  // Taylor series, accurate to well below one Q15 step on 0..pi/2
+  constexpr double taylorSin(double x)
+  {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 10; n++)
+    {
+      term *= -x * x / ((2 * n) * (2 * n + 1));
+      sum += term;
+    }
+    return sum;
+  }
+
+  struct QuarterSine
+  {
+    int16_t q15[91]; // sin(0..90 degrees)
+
+    constexpr QuarterSine() : q15()
+    {
+      for (int d = 0; d <= 90; d++)
+      {
+        q15[d] = (int16_t)(taylorSin(d * PI_DOUBLE / 180.0) * TRIG_ONE + 0.5);
+      }
+    }
+  };
+
+  constexpr QuarterSine quarterSine{};
+}
+
+// sin(degrees) in Q15, any integer angle
+constexpr int16_t isin(int degrees)
+{
+  int d = ((degrees % 360) + 360) % 360;
+  return d <= 90    ? fasttrig::quarterSine.q15[d]
+         : d <= 180 ? fasttrig::quarterSine.q15[180 - d]
+         : d <= 270 ? (int16_t)-fasttrig::quarterSine.q15[d - 180]
+                    : (int16_t)-fasttrig::quarterSine.q15[360 - d];
+}
+
+constexpr int16_t icos(int degrees)
+{
+  return isin(degrees + 90);
+}
+
+// Scale a length by a Q15 factor, rounded to the nearest pixel
+constexpr int scaleQ15(int length, int16_t factor)
+{
+  return (int)(((int32_t)length * factor + (factor >= 0 ? 16384 : -16384)) / 32768);
+}
+
+#endif
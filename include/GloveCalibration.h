@@ -0,0 +1,19 @@
+#ifndef GLOVE_CALIBRATION_H
+#define GLOVE_CALIBRATION_H
+
+#include "GloveProfiles.h"
+#include "GloveProfile.h"
+
+// The glove variant this build is for, shared by the firmware and the host tools.
+// Set with -D GLOVE_HARDWARE=<struct from GloveProfiles.h>, and the frame's
+// channel counts to match with GLOVE_FLEX_COUNT and GLOVE_IMU_COUNT.
+#ifndef GLOVE_HARDWARE
+#define GLOVE_HARDWARE GloveTDisplay5V
+#endif
+
+typedef GloveProfile<GLOVE_HARDWARE> Glove;
+
+static_assert(Glove::flexCount == FLEX_COUNT && Glove::imuCount == IMU_COUNT,
+              "the variant's environment sets GLOVE_FLEX_COUNT and GLOVE_IMU_COUNT to its channel counts");
+
+#endif
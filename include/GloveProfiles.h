@@ -0,0 +1,84 @@
+#ifndef GLOVE_PROFILES_H
+#define GLOVE_PROFILES_H
+
+#include <stdint.h>
+#include "GloveProfile.h"
+
+// The glove variants this firmware builds for, see GloveProfile.h for the members.
+// GloveCalibration.h picks one with -D GLOVE_HARDWARE=<name>, every variant
+// has its environment in platformio.ini.
+
+// LilyGo T-Display glove, sensors on 5 V with each one measured (src/main.cpp)
+struct GloveTDisplay5V
+{
+  static constexpr const char *name = "tdisplay-5v";
+  static constexpr int flexCount = 5;
+  static constexpr int muxCount = 0;
+  static constexpr uint8_t flexPins[flexCount] = {36, 39, 32, 33, 26};
+  static constexpr double vcc = 5.0;
+  static constexpr double rDiv = 10000.0;
+  static constexpr float flatResistance[flexCount] = {54642.00, 57937.00, 44730.00, 60732.00, 48805.00};
+  static constexpr float bendResistance[flexCount] = {158494.00, 125896.00, 68138.00, 136138.00, 134915.00};
+  static constexpr int imuCount = 1;
+  static constexpr uint8_t imuAddresses[imuCount] = {0x68};
+  static constexpr int imuAccelRangeG = 8;
+  static constexpr int imuGyroRangeDps = 500;
+  static constexpr int imuFilterHz = 21;
+};
+
+// First prototype on 3.3 V, datasheet resistances for every finger (Main Code/main.cpp)
+struct GlovePrototype3V3
+{
+  static constexpr const char *name = "prototype-3v3";
+  static constexpr int flexCount = 5;
+  static constexpr int muxCount = 0;
+  static constexpr uint8_t flexPins[flexCount] = {36, 39, 32, 33, 26};
+  static constexpr double vcc = 3.3;
+  static constexpr double rDiv = 10000.0;
+  static constexpr float flatResistance[flexCount] = {32500.0, 32500.0, 32500.0, 32500.0, 32500.0};
+  static constexpr float bendResistance[flexCount] = {76000.0, 76000.0, 76000.0, 76000.0, 76000.0};
+  static constexpr int imuCount = 1;
+  static constexpr uint8_t imuAddresses[imuCount] = {0x68};
+  static constexpr int imuAccelRangeG = 8;
+  static constexpr int imuGyroRangeDps = 500;
+  static constexpr int imuFilterHz = 21;
+};
+
+// The 3.3 V prototype with 15.15k divider resistors (Main Code/Draft.cpp)
+struct GlovePrototype3V3R15k : GlovePrototype3V3
+{
+  static constexpr const char *name = "prototype-3v3-r15k";
+  static constexpr double rDiv = 15150.0;
+};
+
+// Next glove: the five fingers plus four abduction sensors between them and one
+// across the palm for thumb opposition, on two CD74HC4067s so one settles while
+// the other is converted (FlexScan.h), and a second IMU on the back of the hand.
+// The abduction sensors are the short 2.2" kind, datasheet resistances until
+// they are measured.
+struct GloveAbduction
+{
+  static constexpr const char *name = "abduction";
+  static constexpr int flexCount = 10;
+  static constexpr int muxCount = 2;
+  static constexpr uint8_t muxAdcPins[muxCount] = {36, 39};
+  static constexpr uint8_t muxSelectPins[muxCount][MUX_SELECT_BITS] = {{25, 26, 27, 32}, {33, 2, 15, 17}};
+  static constexpr uint8_t flexMuxInputs[flexCount] = {
+      0, 1, 2, 3, 4,                                  // Fingers on mux 0
+      MUX_INPUTS + 0, MUX_INPUTS + 1, MUX_INPUTS + 2, // Abduction and opposition on mux 1
+      MUX_INPUTS + 3, MUX_INPUTS + 4};
+  static constexpr int muxSettleUs = 8;
+  static constexpr double vcc = 3.3;
+  static constexpr double rDiv = 10000.0;
+  static constexpr float flatResistance[flexCount] = {32500.0, 32500.0, 32500.0, 32500.0, 32500.0,
+                                                      25000.0, 25000.0, 25000.0, 25000.0, 25000.0};
+  static constexpr float bendResistance[flexCount] = {76000.0, 76000.0, 76000.0, 76000.0, 76000.0,
+                                                      70000.0, 70000.0, 70000.0, 70000.0, 70000.0};
+  static constexpr int imuCount = 2;
+  static constexpr uint8_t imuAddresses[imuCount] = {0x68, 0x69}; // Wrist, back of the hand (AD0 high)
+  static constexpr int imuAccelRangeG = 8;
+  static constexpr int imuGyroRangeDps = 500;
+  static constexpr int imuFilterHz = 21;
+};
+
+#endif
@@ -0,0 +1,737 @@
+// Generated by   : tools/generate_glyph_atlas.py
+// Generated from : DejaVuSansMono.ttf
+// Unicode ranges : 0x20-0x7E,0xA0-0x17F,0x2013-0x2014,0x2018-0x201E,0x2022,0x2026,0x20AC
+// Pixel sizes    : 11,22
+// Config hash    : 26e9e3b8bfbb34ad
+
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <stdint.h>
+
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+    #define PROGMEM
+#endif
+
+#define GLYPH_COUNT 331
+#define GLYPH_SIZES 2
+#define GLYPH_MAX_CELL_PIXELS 351 // Largest width x height of any size
+
+// Codepoints in ascending order, glyph i of every size belongs to glyphCodepoints[i]
+const uint32_t glyphCodepoints[GLYPH_COUNT] PROGMEM = {
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+  0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043,
+  0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B,
+  0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00A0,
+  0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC,
+  0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8,
+  0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4,
+  0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0,
+  0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC,
+  0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8,
+  0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4,
+  0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100,
+  0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C,
+  0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118,
+  0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124,
+  0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130,
+  0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C,
+  0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148,
+  0x0149, 0x014A, 0x014B, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154,
+  0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0160,
+  0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016A, 0x016B, 0x016C,
+  0x016D, 0x016E, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0178,
+  0x0179, 0x017A, 0x017B, 0x017C, 0x017D, 0x017E, 0x017F, 0x2013, 0x2014, 0x2018, 0x2019, 0x201A,
+  0x201B, 0x201C, 0x201D, 0x201E, 0x2022, 0x2026, 0x20AC,
+};
+
+// Text size 1: 7x14 cells, 1 bytes per row, MSB is the leftmost pixel
+const uint8_t glyphBitmaps1[GLYPH_COUNT * 14] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0020
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,   // U+0021
+  0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0022
+  0x00, 0x00, 0x00, 0x14, 0x2C, 0xFE, 0x28, 0x28, 0xFC, 0x50, 0x50, 0x00, 0x00, 0x00,   // U+0023
+  0x00, 0x00, 0x00, 0x10, 0x3C, 0x50, 0x50, 0x38, 0x1C, 0x14, 0x78, 0x10, 0x10, 0x00,   // U+0024
+  0x00, 0x00, 0x00, 0x60, 0xB0, 0xE4, 0x18, 0x20, 0x5C, 0x16, 0x1C, 0x00, 0x00, 0x00,   // U+0025
+  0x00, 0x00, 0x00, 0x38, 0x60, 0x60, 0x60, 0xD6, 0x8C, 0xCC, 0x7C, 0x00, 0x00, 0x00,   // U+0026
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0027
+  0x00, 0x00, 0x18, 0x10, 0x10, 0x30, 0x30, 0x30, 0x30, 0x10, 0x10, 0x18, 0x00, 0x00,   // U+0028
+  0x00, 0x00, 0x20, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x20, 0x00, 0x00,   // U+0029
+  0x00, 0x00, 0x00, 0x10, 0x54, 0x38, 0x38, 0x54, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0xFC, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,   // U+002B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x20, 0x00, 0x00,   // U+002C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,   // U+002E
+  0x00, 0x00, 0x00, 0x0C, 0x08, 0x18, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00, 0x00,   // U+002F
+  0x00, 0x00, 0x00, 0x38, 0x6C, 0x44, 0x44, 0x54, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+0030
+  0x00, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+0031
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x0C, 0x08, 0x18, 0x30, 0x60, 0x7C, 0x00, 0x00, 0x00,   // U+0032
+  0x00, 0x00, 0x00, 0x38, 0x4C, 0x0C, 0x38, 0x0C, 0x04, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+0033
+  0x00, 0x00, 0x00, 0x18, 0x18, 0x28, 0x68, 0x48, 0xFC, 0x08, 0x08, 0x00, 0x00, 0x00,   // U+0034
+  0x00, 0x00, 0x00, 0x78, 0x40, 0x40, 0x78, 0x0C, 0x0C, 0x0C, 0x78, 0x00, 0x00, 0x00,   // U+0035
+  0x00, 0x00, 0x00, 0x38, 0x60, 0x40, 0x78, 0x4C, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+0036
+  0x00, 0x00, 0x00, 0x7C, 0x0C, 0x08, 0x18, 0x10, 0x10, 0x30, 0x20, 0x00, 0x00, 0x00,   // U+0037
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0x38, 0x4C, 0x44, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+0038
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0x4C, 0x7C, 0x0C, 0x08, 0x78, 0x00, 0x00, 0x00,   // U+0039
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,   // U+003A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x10, 0x30, 0x20, 0x00, 0x00,   // U+003B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x38, 0xE0, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x00,   // U+003C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+003D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x0C, 0x38, 0xC0, 0x00, 0x00, 0x00, 0x00,   // U+003E
+  0x00, 0x00, 0x00, 0x78, 0x0C, 0x08, 0x18, 0x10, 0x10, 0x00, 0x30, 0x00, 0x00, 0x00,   // U+003F
+  0x00, 0x00, 0x00, 0x38, 0x64, 0xC4, 0x9C, 0xA4, 0xA4, 0x9C, 0xC0, 0x60, 0x3C, 0x00,   // U+0040
+  0x00, 0x00, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+0041
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0x78, 0x4C, 0x44, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+0042
+  0x00, 0x00, 0x00, 0x38, 0x64, 0x40, 0x40, 0x40, 0x40, 0x64, 0x38, 0x00, 0x00, 0x00,   // U+0043
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0x44, 0x44, 0x4C, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+0044
+  0x00, 0x00, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+0045
+  0x00, 0x00, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,   // U+0046
+  0x00, 0x00, 0x00, 0x38, 0x64, 0x40, 0xC0, 0xCC, 0x44, 0x64, 0x3C, 0x00, 0x00, 0x00,   // U+0047
+  0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0048
+  0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+0049
+  0x00, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x70, 0x00, 0x00, 0x00,   // U+004A
+  0x00, 0x00, 0x00, 0x44, 0x48, 0x50, 0x70, 0x50, 0x58, 0x4C, 0x44, 0x00, 0x00, 0x00,   // U+004B
+  0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+004C
+  0x00, 0x00, 0x00, 0xCC, 0xEC, 0xEC, 0xF4, 0xD4, 0xC4, 0xC4, 0xC4, 0x00, 0x00, 0x00,   // U+004D
+  0x00, 0x00, 0x00, 0x44, 0x64, 0x64, 0x54, 0x54, 0x5C, 0x4C, 0x4C, 0x00, 0x00, 0x00,   // U+004E
+  0x00, 0x00, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+004F
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x44, 0x4C, 0x78, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,   // U+0050
+  0x00, 0x00, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x08, 0x00, 0x00,   // U+0051
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0x4C, 0x78, 0x48, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0052
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x40, 0x70, 0x1C, 0x04, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+0053
+  0x00, 0x00, 0x00, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+0054
+  0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+0055
+  0x00, 0x00, 0x00, 0xC4, 0x44, 0x4C, 0x68, 0x68, 0x28, 0x38, 0x30, 0x00, 0x00, 0x00,   // U+0056
+  0x00, 0x00, 0x00, 0x86, 0x86, 0xF4, 0xF4, 0x7C, 0x6C, 0x6C, 0x4C, 0x00, 0x00, 0x00,   // U+0057
+  0x00, 0x00, 0x00, 0x44, 0x6C, 0x38, 0x30, 0x38, 0x28, 0x4C, 0xC4, 0x00, 0x00, 0x00,   // U+0058
+  0x00, 0x00, 0x00, 0xC4, 0x4C, 0x28, 0x38, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+0059
+  0x00, 0x00, 0x00, 0x7C, 0x0C, 0x08, 0x10, 0x30, 0x20, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+005A
+  0x00, 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x00, 0x00,   // U+005B
+  0x00, 0x00, 0x00, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x18, 0x08, 0x0C, 0x00, 0x00,   // U+005C
+  0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x00, 0x00,   // U+005D
+  0x00, 0x00, 0x00, 0x30, 0x68, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+005E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,   // U+005F
+  0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0060
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+0061
+  0x00, 0x00, 0x40, 0x40, 0x40, 0x78, 0x6C, 0x44, 0x44, 0x6C, 0x78, 0x00, 0x00, 0x00,   // U+0062
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x60, 0x40, 0x40, 0x60, 0x3C, 0x00, 0x00, 0x00,   // U+0063
+  0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+0064
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+0065
+  0x00, 0x00, 0x1C, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+0066
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x0C, 0x78, 0x00,   // U+0067
+  0x00, 0x00, 0x40, 0x40, 0x40, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0068
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+0069
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00,   // U+006A
+  0x00, 0x00, 0x40, 0x40, 0x40, 0x4C, 0x58, 0x70, 0x78, 0x4C, 0x44, 0x00, 0x00, 0x00,   // U+006B
+  0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+006C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0x00, 0x00, 0x00,   // U+006D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+006E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+006F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x6C, 0x44, 0x44, 0x6C, 0x78, 0x40, 0x40, 0x00,   // U+0070
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x4C, 0x4C, 0x4C, 0x4C, 0x3C, 0x04, 0x04, 0x00,   // U+0071
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x30, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,   // U+0072
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60, 0x70, 0x18, 0x0C, 0x78, 0x00, 0x00, 0x00,   // U+0073
+  0x00, 0x00, 0x00, 0x20, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+0074
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+0075
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4C, 0x68, 0x28, 0x38, 0x30, 0x00, 0x00, 0x00,   // U+0076
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x84, 0xD4, 0x74, 0x6C, 0x68, 0x00, 0x00, 0x00,   // U+0077
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x28, 0x30, 0x30, 0x68, 0x44, 0x00, 0x00, 0x00,   // U+0078
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4C, 0x68, 0x28, 0x30, 0x10, 0x30, 0x60, 0x00,   // U+0079
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0x10, 0x30, 0x60, 0x7C, 0x00, 0x00, 0x00,   // U+007A
+  0x00, 0x00, 0x1C, 0x10, 0x10, 0x30, 0x60, 0x30, 0x10, 0x10, 0x10, 0x1C, 0x00, 0x00,   // U+007B
+  0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,   // U+007C
+  0x00, 0x00, 0x60, 0x30, 0x10, 0x10, 0x1C, 0x10, 0x10, 0x10, 0x30, 0x60, 0x00, 0x00,   // U+007D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+007E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,   // U+00A1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x60, 0x40, 0x40, 0x60, 0x3C, 0x00, 0x00, 0x00,   // U+00A2
+  0x00, 0x00, 0x00, 0x1C, 0x34, 0x20, 0x20, 0x78, 0x20, 0x20, 0x7C, 0x00, 0x00, 0x00,   // U+00A3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7C, 0x28, 0x28, 0x7C, 0x44, 0x00, 0x00, 0x00,   // U+00A4
+  0x00, 0x00, 0x00, 0xC4, 0x4C, 0x68, 0xFC, 0x30, 0xFC, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+00A5
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,   // U+00A6
+  0x00, 0x00, 0x00, 0x38, 0x60, 0x30, 0x58, 0x4C, 0x38, 0x18, 0x08, 0x78, 0x00, 0x00,   // U+00A7
+  0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A8
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x7C, 0xC2, 0xC2, 0xBA, 0x44, 0x38, 0x00, 0x00, 0x00,   // U+00A9
+  0x00, 0x00, 0x00, 0x38, 0x38, 0x68, 0x38, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AA
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x50, 0x68, 0x24, 0x00, 0x00, 0x00, 0x00,   // U+00AB
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AC
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AD
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x7C, 0xBA, 0xBA, 0xAA, 0x44, 0x38, 0x00, 0x00, 0x00,   // U+00AE
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AF
+  0x00, 0x00, 0x00, 0x38, 0x28, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B0
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0xFC, 0x10, 0x10, 0x00, 0xFC, 0x00, 0x00, 0x00,   // U+00B1
+  0x00, 0x00, 0x00, 0x38, 0x08, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B2
+  0x00, 0x00, 0x00, 0x38, 0x38, 0x08, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B3
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B4
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x7C, 0x40, 0x40, 0x00,   // U+00B5
+  0x00, 0x00, 0x00, 0x7C, 0x74, 0xF4, 0x74, 0x74, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00,   // U+00B6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x00,   // U+00B8
+  0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B9
+  0x00, 0x00, 0x00, 0x38, 0x68, 0x68, 0x38, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00BA
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x68, 0x34, 0x68, 0x50, 0x00, 0x00, 0x00, 0x00,   // U+00BB
+  0x00, 0x00, 0xE0, 0x20, 0x20, 0xF0, 0x3C, 0xF0, 0x08, 0x08, 0x3C, 0x08, 0x00, 0x00,   // U+00BC
+  0x00, 0x00, 0xE0, 0x20, 0x20, 0xF0, 0x3C, 0xF0, 0x1C, 0x04, 0x08, 0x1C, 0x00, 0x00,   // U+00BD
+  0x00, 0x00, 0x70, 0x60, 0x10, 0xE0, 0x3C, 0xF0, 0x08, 0x08, 0x3C, 0x08, 0x00, 0x00,   // U+00BE
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x10, 0x30, 0x60, 0x60, 0x78, 0x00,   // U+00BF
+  0x00, 0x30, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+00C0
+  0x00, 0x10, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+00C1
+  0x00, 0x38, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+00C2
+  0x38, 0x78, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+00C3
+  0x00, 0x28, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+00C4
+  0x00, 0x38, 0x28, 0x30, 0x38, 0x28, 0x68, 0x4C, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+00C5
+  0x00, 0x00, 0x00, 0x3C, 0x38, 0x78, 0x5C, 0x58, 0x78, 0xD8, 0x9C, 0x00, 0x00, 0x00,   // U+00C6
+  0x00, 0x00, 0x00, 0x38, 0x64, 0x40, 0x40, 0x40, 0x40, 0x64, 0x38, 0x08, 0x18, 0x00,   // U+00C7
+  0x00, 0x10, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+00C8
+  0x00, 0x10, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+00C9
+  0x00, 0x38, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+00CA
+  0x00, 0x28, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+00CB
+  0x00, 0x30, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00CC
+  0x00, 0x10, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00CD
+  0x00, 0x38, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00CE
+  0x00, 0x28, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00CF
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0xE4, 0x44, 0x4C, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+00D0
+  0x38, 0x78, 0x00, 0x44, 0x64, 0x64, 0x54, 0x54, 0x5C, 0x4C, 0x4C, 0x00, 0x00, 0x00,   // U+00D1
+  0x00, 0x30, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+00D2
+  0x00, 0x10, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+00D3
+  0x00, 0x38, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+00D4
+  0x38, 0x78, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+00D5
+  0x00, 0x28, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+00D6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x38, 0x30, 0x38, 0x44, 0x00, 0x00, 0x00, 0x00,   // U+00D7
+  0x00, 0x00, 0x00, 0x3C, 0x6C, 0x4C, 0xD4, 0x64, 0x64, 0x4C, 0xB8, 0x00, 0x00, 0x00,   // U+00D8
+  0x00, 0x30, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00D9
+  0x00, 0x10, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00DA
+  0x00, 0x38, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00DB
+  0x00, 0x28, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00DC
+  0x00, 0x10, 0x00, 0xC4, 0x4C, 0x28, 0x38, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+00DD
+  0x00, 0x00, 0x00, 0x40, 0x7C, 0x44, 0x44, 0x44, 0x7C, 0x40, 0x40, 0x00, 0x00, 0x00,   // U+00DE
+  0x00, 0x00, 0x38, 0x48, 0x48, 0x50, 0x50, 0x58, 0x44, 0x44, 0x7C, 0x00, 0x00, 0x00,   // U+00DF
+  0x00, 0x00, 0x20, 0x10, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+00E0
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+00E1
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+00E2
+  0x00, 0x00, 0x28, 0x58, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+00E3
+  0x00, 0x00, 0x00, 0x28, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+00E4
+  0x00, 0x30, 0x28, 0x30, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+00E5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x16, 0x7E, 0x90, 0x90, 0x7C, 0x00, 0x00, 0x00,   // U+00E6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x60, 0x40, 0x40, 0x60, 0x3C, 0x08, 0x18, 0x00,   // U+00E7
+  0x00, 0x00, 0x20, 0x10, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+00E8
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+00E9
+  0x00, 0x00, 0x10, 0x28, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+00EA
+  0x00, 0x00, 0x00, 0x28, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+00EB
+  0x00, 0x00, 0x20, 0x10, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00EC
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00ED
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00EE
+  0x00, 0x00, 0x00, 0x28, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+00EF
+  0x00, 0x00, 0x28, 0x30, 0x18, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00F0
+  0x00, 0x00, 0x28, 0x58, 0x00, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+00F1
+  0x00, 0x00, 0x20, 0x10, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00F2
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00F3
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00F4
+  0x00, 0x00, 0x28, 0x58, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00F5
+  0x00, 0x00, 0x00, 0x28, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+00F6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,   // U+00F7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x4C, 0x5C, 0x64, 0x6C, 0xF8, 0x00, 0x00, 0x00,   // U+00F8
+  0x00, 0x00, 0x20, 0x10, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+00F9
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+00FA
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+00FB
+  0x00, 0x00, 0x00, 0x28, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+00FC
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x44, 0x4C, 0x68, 0x28, 0x30, 0x10, 0x30, 0x60, 0x00,   // U+00FD
+  0x00, 0x00, 0x40, 0x40, 0x40, 0x78, 0x6C, 0x44, 0x44, 0x6C, 0x78, 0x40, 0x40, 0x00,   // U+00FE
+  0x00, 0x00, 0x00, 0x28, 0x00, 0x44, 0x4C, 0x68, 0x28, 0x30, 0x10, 0x30, 0x60, 0x00,   // U+00FF
+  0x00, 0x38, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+0100
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+0101
+  0x28, 0x38, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x00, 0x00, 0x00,   // U+0102
+  0x00, 0x00, 0x28, 0x38, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+0103
+  0x00, 0x00, 0x00, 0x30, 0x38, 0x28, 0x68, 0x48, 0x7C, 0x44, 0xC4, 0x04, 0x06, 0x00,   // U+0104
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0C, 0x7C, 0x4C, 0x4C, 0x7C, 0x08, 0x0C, 0x00,   // U+0105
+  0x00, 0x18, 0x00, 0x38, 0x64, 0x40, 0x40, 0x40, 0x40, 0x64, 0x38, 0x00, 0x00, 0x00,   // U+0106
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x3C, 0x60, 0x40, 0x40, 0x60, 0x3C, 0x00, 0x00, 0x00,   // U+0107
+  0x00, 0x18, 0x00, 0x38, 0x64, 0x40, 0x40, 0x40, 0x40, 0x64, 0x38, 0x00, 0x00, 0x00,   // U+0108
+  0x00, 0x00, 0x18, 0x28, 0x00, 0x3C, 0x60, 0x40, 0x40, 0x60, 0x3C, 0x00, 0x00, 0x00,   // U+0109
+  0x00, 0x10, 0x00, 0x38, 0x64, 0x40, 0x40, 0x40, 0x40, 0x64, 0x38, 0x00, 0x00, 0x00,   // U+010A
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x3C, 0x60, 0x40, 0x40, 0x60, 0x3C, 0x00, 0x00, 0x00,   // U+010B
+  0x00, 0x18, 0x00, 0x38, 0x64, 0x40, 0x40, 0x40, 0x40, 0x64, 0x38, 0x00, 0x00, 0x00,   // U+010C
+  0x00, 0x00, 0x28, 0x18, 0x00, 0x3C, 0x60, 0x40, 0x40, 0x60, 0x3C, 0x00, 0x00, 0x00,   // U+010D
+  0x00, 0x30, 0x00, 0x78, 0x4C, 0x4C, 0x44, 0x44, 0x4C, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+010E
+  0x00, 0x00, 0x0E, 0x0E, 0x0C, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+010F
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0xE4, 0x44, 0x4C, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+0110
+  0x00, 0x00, 0x0C, 0x1E, 0x0C, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x00, 0x00, 0x00,   // U+0111
+  0x00, 0x38, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+0112
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+0113
+  0x28, 0x38, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+0114
+  0x00, 0x00, 0x28, 0x38, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+0115
+  0x00, 0x10, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+0116
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+0117
+  0x00, 0x00, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x08, 0x0C, 0x00,   // U+0118
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x08, 0x0C, 0x00,   // U+0119
+  0x00, 0x38, 0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+011A
+  0x00, 0x00, 0x28, 0x10, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x00,   // U+011B
+  0x00, 0x38, 0x00, 0x38, 0x64, 0x40, 0xC0, 0xCC, 0x44, 0x64, 0x3C, 0x00, 0x00, 0x00,   // U+011C
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x0C, 0x78, 0x00,   // U+011D
+  0x28, 0x38, 0x00, 0x38, 0x64, 0x40, 0xC0, 0xCC, 0x44, 0x64, 0x3C, 0x00, 0x00, 0x00,   // U+011E
+  0x00, 0x00, 0x28, 0x38, 0x00, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x0C, 0x78, 0x00,   // U+011F
+  0x00, 0x10, 0x00, 0x38, 0x64, 0x40, 0xC0, 0xCC, 0x44, 0x64, 0x3C, 0x00, 0x00, 0x00,   // U+0120
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x0C, 0x78, 0x00,   // U+0121
+  0x00, 0x00, 0x00, 0x38, 0x64, 0x40, 0xC0, 0xCC, 0x44, 0x64, 0x3C, 0x00, 0x18, 0x10,   // U+0122
+  0x00, 0x00, 0x10, 0x10, 0x00, 0x7C, 0x4C, 0x4C, 0x4C, 0x4C, 0x7C, 0x0C, 0x78, 0x00,   // U+0123
+  0x00, 0x38, 0x00, 0x44, 0x44, 0x44, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0124
+  0x38, 0x00, 0x40, 0x40, 0x40, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0125
+  0x00, 0x00, 0x00, 0x44, 0xFE, 0x44, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0126
+  0x00, 0x00, 0x40, 0xF0, 0x40, 0x78, 0x6C, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0127
+  0x38, 0x78, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+0128
+  0x00, 0x00, 0x28, 0x58, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+0129
+  0x00, 0x38, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+012A
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+012B
+  0x28, 0x38, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+012C
+  0x00, 0x00, 0x28, 0x38, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+012D
+  0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x10, 0x18, 0x00,   // U+012E
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x10, 0x18, 0x00,   // U+012F
+  0x00, 0x10, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+0130
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00,   // U+0131
+  0x00, 0x00, 0x00, 0xEE, 0x42, 0x42, 0x42, 0x42, 0x42, 0x56, 0xFC, 0x00, 0x00, 0x00,   // U+0132
+  0x00, 0x00, 0x64, 0x00, 0x00, 0xFC, 0x64, 0x64, 0x64, 0x64, 0xF4, 0x04, 0x1C, 0x00,   // U+0133
+  0x00, 0x38, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x70, 0x00, 0x00, 0x00,   // U+0134
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00,   // U+0135
+  0x00, 0x00, 0x00, 0x44, 0x48, 0x50, 0x70, 0x50, 0x58, 0x4C, 0x44, 0x00, 0x10, 0x10,   // U+0136
+  0x00, 0x00, 0x40, 0x40, 0x40, 0x4C, 0x58, 0x70, 0x78, 0x4C, 0x44, 0x00, 0x18, 0x10,   // U+0137
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x58, 0x70, 0x78, 0x4C, 0x44, 0x00, 0x00, 0x00,   // U+0138
+  0x00, 0x60, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+0139
+  0x30, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+013A
+  0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x10, 0x10,   // U+013B
+  0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1C, 0x00, 0x30, 0x20,   // U+013C
+  0x00, 0x00, 0x00, 0x48, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+013D
+  0x00, 0x00, 0x74, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+013E
+  0x00, 0x00, 0x00, 0x40, 0x40, 0x4C, 0x4C, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+013F
+  0x00, 0x00, 0x70, 0x30, 0x30, 0x36, 0x36, 0x30, 0x30, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+0140
+  0x00, 0x00, 0x00, 0x40, 0x40, 0x50, 0x60, 0xC0, 0x40, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+0141
+  0x00, 0x00, 0x70, 0x30, 0x38, 0x38, 0x30, 0x70, 0x30, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+0142
+  0x00, 0x10, 0x00, 0x44, 0x64, 0x64, 0x54, 0x54, 0x5C, 0x4C, 0x4C, 0x00, 0x00, 0x00,   // U+0143
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0144
+  0x00, 0x00, 0x00, 0x44, 0x64, 0x64, 0x54, 0x54, 0x5C, 0x4C, 0x4C, 0x00, 0x10, 0x30,   // U+0145
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x00, 0x10, 0x30,   // U+0146
+  0x00, 0x38, 0x00, 0x44, 0x64, 0x64, 0x54, 0x54, 0x5C, 0x4C, 0x4C, 0x00, 0x00, 0x00,   // U+0147
+  0x00, 0x00, 0x28, 0x30, 0x00, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0148
+  0x00, 0x00, 0x40, 0xC0, 0x80, 0x3C, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00,   // U+0149
+  0x00, 0x00, 0x00, 0x78, 0x6C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0C, 0x18, 0x00,   // U+014A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x6C, 0x4C, 0x44, 0x44, 0x44, 0x0C, 0x18, 0x00,   // U+014B
+  0x00, 0x38, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+014C
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+014D
+  0x28, 0x38, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+014E
+  0x00, 0x00, 0x28, 0x38, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+014F
+  0x00, 0x38, 0x00, 0x38, 0x6C, 0x44, 0xC4, 0xC4, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00,   // U+0150
+  0x00, 0x00, 0x38, 0x28, 0x00, 0x38, 0x4C, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+0151
+  0x00, 0x00, 0x00, 0x7E, 0x58, 0xD8, 0xDC, 0xD8, 0xD8, 0x58, 0x7E, 0x00, 0x00, 0x00,   // U+0152
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x96, 0x9E, 0x90, 0x90, 0x7E, 0x00, 0x00, 0x00,   // U+0153
+  0x00, 0x10, 0x00, 0x78, 0x4C, 0x4C, 0x4C, 0x78, 0x48, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0154
+  0x00, 0x00, 0x04, 0x08, 0x00, 0x3C, 0x30, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,   // U+0155
+  0x00, 0x00, 0x00, 0x78, 0x4C, 0x4C, 0x4C, 0x78, 0x48, 0x44, 0x44, 0x00, 0x10, 0x10,   // U+0156
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x30, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20,   // U+0157
+  0x00, 0x30, 0x00, 0x78, 0x4C, 0x4C, 0x4C, 0x78, 0x48, 0x44, 0x44, 0x00, 0x00, 0x00,   // U+0158
+  0x00, 0x00, 0x28, 0x18, 0x00, 0x3C, 0x30, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,   // U+0159
+  0x00, 0x10, 0x00, 0x38, 0x44, 0x40, 0x70, 0x1C, 0x04, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+015A
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x38, 0x60, 0x70, 0x18, 0x0C, 0x78, 0x00, 0x00, 0x00,   // U+015B
+  0x00, 0x38, 0x00, 0x38, 0x44, 0x40, 0x70, 0x1C, 0x04, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+015C
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x38, 0x60, 0x70, 0x18, 0x0C, 0x78, 0x00, 0x00, 0x00,   // U+015D
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x40, 0x70, 0x1C, 0x04, 0x4C, 0x78, 0x10, 0x30, 0x00,   // U+015E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60, 0x70, 0x18, 0x0C, 0x78, 0x10, 0x30, 0x00,   // U+015F
+  0x00, 0x38, 0x00, 0x38, 0x44, 0x40, 0x70, 0x1C, 0x04, 0x4C, 0x78, 0x00, 0x00, 0x00,   // U+0160
+  0x00, 0x00, 0x28, 0x30, 0x00, 0x38, 0x60, 0x70, 0x18, 0x0C, 0x78, 0x00, 0x00, 0x00,   // U+0161
+  0x00, 0x00, 0x00, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x00,   // U+0162
+  0x00, 0x00, 0x00, 0x20, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x30, 0x1C, 0x08, 0x18, 0x00,   // U+0163
+  0x00, 0x38, 0x00, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+0164
+  0x00, 0x00, 0x08, 0x28, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+0165
+  0x00, 0x00, 0x00, 0xFE, 0x10, 0x10, 0x10, 0x78, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+0166
+  0x00, 0x00, 0x00, 0x20, 0x20, 0x7C, 0x20, 0x78, 0x20, 0x30, 0x1C, 0x00, 0x00, 0x00,   // U+0167
+  0x38, 0x78, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+0168
+  0x00, 0x00, 0x28, 0x58, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+0169
+  0x00, 0x38, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+016A
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+016B
+  0x28, 0x38, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+016C
+  0x00, 0x00, 0x28, 0x38, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+016D
+  0x38, 0x28, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+016E
+  0x00, 0x38, 0x28, 0x38, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+016F
+  0x00, 0x38, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x00, 0x00,   // U+0170
+  0x00, 0x00, 0x38, 0x28, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x00, 0x00, 0x00,   // U+0171
+  0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x38, 0x00, 0x38, 0x00,   // U+0172
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x3C, 0x04, 0x0E, 0x00,   // U+0173
+  0x00, 0x38, 0x00, 0x86, 0x86, 0xF4, 0xF4, 0x7C, 0x6C, 0x6C, 0x4C, 0x00, 0x00, 0x00,   // U+0174
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x86, 0x84, 0xD4, 0x74, 0x6C, 0x68, 0x00, 0x00, 0x00,   // U+0175
+  0x00, 0x38, 0x00, 0xC4, 0x4C, 0x28, 0x38, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+0176
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x44, 0x4C, 0x68, 0x28, 0x30, 0x10, 0x30, 0x60, 0x00,   // U+0177
+  0x00, 0x28, 0x00, 0xC4, 0x4C, 0x28, 0x38, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+0178
+  0x00, 0x10, 0x00, 0x7C, 0x0C, 0x08, 0x10, 0x30, 0x20, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+0179
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x7C, 0x08, 0x10, 0x30, 0x60, 0x7C, 0x00, 0x00, 0x00,   // U+017A
+  0x00, 0x10, 0x00, 0x7C, 0x0C, 0x08, 0x10, 0x30, 0x20, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+017B
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0x08, 0x10, 0x30, 0x60, 0x7C, 0x00, 0x00, 0x00,   // U+017C
+  0x00, 0x38, 0x00, 0x7C, 0x0C, 0x08, 0x10, 0x30, 0x20, 0x40, 0x7C, 0x00, 0x00, 0x00,   // U+017D
+  0x00, 0x00, 0x28, 0x30, 0x00, 0x7C, 0x08, 0x10, 0x30, 0x60, 0x7C, 0x00, 0x00, 0x00,   // U+017E
+  0x00, 0x00, 0x1C, 0x10, 0x10, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // U+017F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2013
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2014
+  0x00, 0x00, 0x10, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2018
+  0x00, 0x00, 0x18, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2019
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x20, 0x00, 0x00,   // U+201A
+  0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201B
+  0x00, 0x00, 0x28, 0x68, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201C
+  0x00, 0x00, 0x2C, 0x68, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x68, 0x48, 0x00, 0x00,   // U+201E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2022
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 0x00,   // U+2026
+  0x00, 0x00, 0x00, 0x38, 0x64, 0xF8, 0x40, 0xF0, 0x40, 0x64, 0x38, 0x00, 0x00, 0x00,   // U+20AC
+};
+
+// Text size 2: 13x27 cells, 2 bytes per row, MSB is the leftmost pixel
+const uint8_t glyphBitmaps2[GLYPH_COUNT * 54] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0020
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0021
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x1C, 0xC0, 0x1C, 0xC0, 0x1C, 0xC0, 0x1C, 0xC0, 0x1C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0022
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x7F, 0xF8, 0x7F, 0xF8, 0x0C, 0xC0, 0x0C, 0xC0, 0x18, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x19, 0x80, 0x31, 0x80, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0023
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x3B, 0x60, 0x33, 0x00, 0x33, 0x00, 0x3B, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0x70, 0x03, 0x30, 0x03, 0x30, 0x33, 0x70, 0x3F, 0xE0, 0x1F, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0024
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x66, 0x00, 0xC6, 0x00, 0xC2, 0x00, 0xC6, 0x00, 0x66, 0x10, 0x3C, 0x70, 0x03, 0xC0, 0x1E, 0x00, 0x71, 0xE0, 0x01, 0xB0, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x01, 0xB0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0025
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x18, 0x80, 0x38, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x3E, 0x00, 0x77, 0x18, 0x63, 0x18, 0x61, 0x98, 0xE0, 0xF0, 0x60, 0xF0, 0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0026
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0027
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0028
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0029
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x32, 0x20, 0x3A, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0x3A, 0xE0, 0x32, 0x20, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+002F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x38, 0x60, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x77, 0x70, 0x77, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0030
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x80, 0x1B, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0031
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x30, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0032
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x30, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x60, 0xE0, 0x7F, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0033
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x06, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x30, 0xC0, 0x60, 0xC0, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0034
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x31, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x60, 0x61, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0035
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x1C, 0x60, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0x77, 0xC0, 0x7F, 0xE0, 0x78, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0036
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0037
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x30, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xC0, 0x1F, 0xC0, 0x38, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x38, 0xF0, 0x3F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0038
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x38, 0xE0, 0x70, 0x60, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x38, 0xF0, 0x3F, 0xF0, 0x0F, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x31, 0xE0, 0x3F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0039
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+003A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+003B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x03, 0xE0, 0x1F, 0x80, 0x7C, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+003C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+003D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x70, 0x01, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+003E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xE0, 0x10, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x01, 0xC0, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+003F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x3C, 0x70, 0x70, 0x30, 0x60, 0x18, 0x63, 0xD8, 0xC7, 0xF8, 0xC6, 0x38, 0xCC, 0x18, 0xCC, 0x18, 0xC6, 0x38, 0xC7, 0xF8, 0x63, 0xD8, 0x60, 0x00, 0x30, 0x00, 0x3C, 0x00, 0x1F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0040
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0041
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x30, 0xE0, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0xE0, 0x3F, 0xC0, 0x3F, 0xE0, 0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0042
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x30, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0043
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x71, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x71, 0xE0, 0x7F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0044
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0045
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0046
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x3C, 0x20, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x38, 0x30, 0x3C, 0x70, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0047
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0048
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0049
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x40, 0xC0, 0x71, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+004A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x38, 0x70, 0x70, 0x70, 0xE0, 0x71, 0xC0, 0x73, 0x80, 0x77, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x73, 0x80, 0x71, 0xC0, 0x71, 0xC0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+004B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+004C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x78, 0x70, 0x78, 0xF0, 0x78, 0xF0, 0x6C, 0xF0, 0x6D, 0xB0, 0x6D, 0xB0, 0x67, 0x30, 0x67, 0x30, 0x67, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+004D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x78, 0x30, 0x78, 0x30, 0x7C, 0x30, 0x7C, 0x30, 0x76, 0x30, 0x76, 0x30, 0x76, 0x30, 0x73, 0x30, 0x73, 0x30, 0x71, 0xB0, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+004E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+004F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x30, 0xF0, 0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0x30, 0xF0, 0x3F, 0xE0, 0x3F, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0050
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0051
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x70, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x71, 0xC0, 0x70, 0xE0, 0x70, 0x60, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0052
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x70, 0x30, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0053
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0054
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0055
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x60, 0x30, 0x70, 0x30, 0x70, 0x70, 0x30, 0x60, 0x30, 0x60, 0x38, 0x60, 0x18, 0xE0, 0x18, 0xC0, 0x1C, 0xC0, 0x0D, 0xC0, 0x0D, 0x80, 0x0D, 0x80, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0056
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x18, 0xE0, 0x18, 0x67, 0x38, 0x67, 0x38, 0x67, 0x30, 0x67, 0xB0, 0x6D, 0xB0, 0x6D, 0xB0, 0x7D, 0xB0, 0x3C, 0xF0, 0x38, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0057
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x38, 0x30, 0x70, 0x38, 0x60, 0x18, 0xE0, 0x0C, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0xC0, 0x18, 0xC0, 0x38, 0x60, 0x30, 0x70, 0x70, 0x30, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0058
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x70, 0x30, 0x30, 0x70, 0x38, 0xE0, 0x18, 0xC0, 0x1D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0059
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+005A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+005B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+005C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+005D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0F, 0x80, 0x1D, 0xC0, 0x18, 0xE0, 0x30, 0x60, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+005E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00,   // U+005F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0060
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0061
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x70, 0x3C, 0xE0, 0x3F, 0xE0, 0x37, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0062
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x20, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x20, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0063
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0064
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0065
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0066
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x10, 0xE0, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00,   // U+0067
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0068
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0069
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x00,   // U+006A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x70, 0x38, 0xE0, 0x39, 0xC0, 0x3B, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3B, 0x80, 0x39, 0xC0, 0x38, 0xC0, 0x38, 0x60, 0x38, 0x70, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+006B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+006C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xE0, 0x7F, 0xF0, 0x77, 0x30, 0x63, 0x30, 0x63, 0x30, 0x63, 0x30, 0x63, 0x30, 0x63, 0x30, 0x63, 0x30, 0x63, 0x30, 0x63, 0x30, 0x63, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+006D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+006E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+006F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x70, 0x3C, 0xE0, 0x3F, 0xE0, 0x37, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00,   // U+0070
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00,   // U+0071
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x0D, 0xF8, 0x0F, 0x10, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0072
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x38, 0x00, 0x38, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x30, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0073
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0074
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0075
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x70, 0x70, 0x30, 0x60, 0x30, 0x60, 0x18, 0xE0, 0x18, 0xC0, 0x1C, 0xC0, 0x0D, 0xC0, 0x0D, 0x80, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0076
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x18, 0x60, 0x38, 0x67, 0x30, 0x67, 0x30, 0x67, 0x30, 0x35, 0xB0, 0x3D, 0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0077
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x38, 0x60, 0x18, 0xC0, 0x0D, 0xC0, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x80, 0x1D, 0xC0, 0x18, 0xE0, 0x30, 0x60, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0078
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0x38, 0x60, 0x18, 0xE0, 0x18, 0xC0, 0x0C, 0xC0, 0x0D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00,   // U+0079
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+007A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+007B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,   // U+007C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+007D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x10, 0x7F, 0xF0, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+007E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x07, 0xE0, 0x0F, 0xF0, 0x1D, 0xB0, 0x19, 0x80, 0x39, 0x80, 0x39, 0x80, 0x39, 0x80, 0x39, 0x80, 0x19, 0x80, 0x1D, 0xB0, 0x0F, 0xF0, 0x07, 0xE0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x0F, 0x10, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x1F, 0xE0, 0x0C, 0xC0, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x0C, 0xC0, 0x1F, 0xE0, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A4
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x70, 0x30, 0x30, 0x60, 0x18, 0xE0, 0x18, 0xC0, 0x7D, 0xF0, 0x7F, 0xF0, 0x07, 0x00, 0x07, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x1C, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x1B, 0xC0, 0x31, 0xE0, 0x30, 0x60, 0x38, 0x60, 0x1C, 0x60, 0x0F, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0xC0, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x38, 0x60, 0x60, 0x30, 0x4F, 0x98, 0xD8, 0x08, 0x98, 0x08, 0x90, 0x08, 0x98, 0x08, 0xD8, 0x08, 0x4F, 0x98, 0x60, 0x30, 0x38, 0x60, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00A9
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x18, 0xC0, 0x00, 0xC0, 0x0F, 0xC0, 0x18, 0x40, 0x18, 0xC0, 0x18, 0xC0, 0x19, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AA
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0C, 0x60, 0x1C, 0xE0, 0x39, 0xC0, 0x73, 0x80, 0x73, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x0C, 0x60, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AB
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AC
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AD
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x38, 0x60, 0x60, 0x30, 0x4F, 0x98, 0xC8, 0xC8, 0x88, 0xC8, 0x8F, 0x88, 0x89, 0x88, 0xC8, 0x88, 0x48, 0xD8, 0x60, 0x30, 0x38, 0x60, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AE
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00AF
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0C, 0x80, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x0C, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x19, 0x80, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x08, 0xC0, 0x00, 0xC0, 0x07, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x19, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B4
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xF0, 0x3F, 0xF8, 0x37, 0xB8, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00,   // U+00B5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0x60, 0x7F, 0x60, 0x7F, 0x60, 0x7F, 0x60, 0x7F, 0x60, 0x7F, 0x60, 0x3F, 0x60, 0x1F, 0x60, 0x03, 0x60, 0x03, 0x60, 0x03, 0x60, 0x03, 0x60, 0x03, 0x60, 0x03, 0x60, 0x03, 0x60, 0x03, 0x60, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00B9
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1C, 0xC0, 0x18, 0xC0, 0x18, 0x60, 0x30, 0x60, 0x18, 0x60, 0x18, 0xC0, 0x1C, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00BA
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x06, 0x70, 0x06, 0x70, 0x1C, 0xE0, 0x39, 0xC0, 0x31, 0x80, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00BB
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x7E, 0x00, 0x00, 0x70, 0x07, 0xE0, 0x3E, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0x01, 0x60, 0x03, 0x60, 0x02, 0x60, 0x06, 0x60, 0x07, 0xF0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00BC
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x7E, 0x00, 0x00, 0x70, 0x07, 0xE0, 0x3E, 0x00, 0xE3, 0xE0, 0x02, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00BD
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x46, 0x00, 0x06, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x46, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x07, 0xE0, 0x3E, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0x01, 0x60, 0x03, 0x60, 0x02, 0x60, 0x06, 0x60, 0x07, 0xF0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00BE
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x60, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00,   // U+00BF
+  0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C0
+  0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C1
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C2
+  0x00, 0x00, 0x0E, 0xC0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C3
+  0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C4
+  0x00, 0x00, 0x07, 0x00, 0x0C, 0x80, 0x08, 0xC0, 0x0C, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0xC0, 0x1C, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x0D, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x39, 0x80, 0x31, 0xF0, 0x31, 0xF0, 0x31, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x61, 0x80, 0x61, 0x80, 0xE1, 0xF8, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x30, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x80, 0x00, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,   // U+00C7
+  0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C8
+  0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00C9
+  0x07, 0x00, 0x07, 0x80, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00CA
+  0x00, 0x00, 0x1C, 0xC0, 0x1C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00CB
+  0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00CC
+  0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00CD
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00CE
+  0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00CF
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x71, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xFE, 0x70, 0xFE, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x71, 0xE0, 0x7F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D0
+  0x00, 0x00, 0x0E, 0xC0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x78, 0x30, 0x78, 0x30, 0x7C, 0x30, 0x7C, 0x30, 0x76, 0x30, 0x76, 0x30, 0x76, 0x30, 0x73, 0x30, 0x73, 0x30, 0x71, 0xB0, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D1
+  0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D2
+  0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D3
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D4
+  0x00, 0x00, 0x0E, 0xC0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D5
+  0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x38, 0x60, 0x1C, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x1C, 0xE0, 0x38, 0x60, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x98, 0x1F, 0xF0, 0x38, 0xF0, 0x30, 0x60, 0x70, 0xF0, 0x71, 0xF0, 0x71, 0xB0, 0x73, 0x30, 0x76, 0x30, 0x7C, 0x30, 0x7C, 0x70, 0x78, 0x70, 0x30, 0x70, 0x78, 0xE0, 0x7F, 0xC0, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D8
+  0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00D9
+  0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00DA
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00DB
+  0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00DC
+  0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x70, 0x30, 0x30, 0x70, 0x38, 0xE0, 0x18, 0xC0, 0x1D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00DD
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x30, 0x70, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x70, 0x3F, 0xF0, 0x3F, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00DE
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x60, 0x30, 0xE0, 0x33, 0x80, 0x33, 0x00, 0x33, 0x00, 0x33, 0x80, 0x31, 0xC0, 0x30, 0xE0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 0x70, 0x37, 0xF0, 0x33, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00DF
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x1B, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E4
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x08, 0xC0, 0x0D, 0x80, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x7F, 0xF0, 0x47, 0x38, 0x03, 0x18, 0x03, 0x18, 0x3F, 0xF8, 0x7F, 0xF8, 0xE3, 0x00, 0xC3, 0x00, 0xE7, 0x08, 0x7F, 0xF8, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x20, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x20, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x80, 0x00, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,   // U+00E7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00E9
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00EA
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x1C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00EB
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00EC
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00ED
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00EE
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00EF
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0F, 0xC0, 0x0F, 0x00, 0x1B, 0x80, 0x01, 0xC0, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x1B, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F4
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x1B, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x90, 0x1F, 0xF0, 0x38, 0xE0, 0x30, 0xE0, 0x71, 0xF0, 0x73, 0x70, 0x76, 0x70, 0x3C, 0x70, 0x38, 0x70, 0x38, 0xE0, 0x7F, 0xE0, 0x6F, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00F9
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00FA
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00FB
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+00FC
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0x38, 0x60, 0x18, 0xE0, 0x18, 0xC0, 0x0C, 0xC0, 0x0D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00,   // U+00FD
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x70, 0x3C, 0xE0, 0x3F, 0xE0, 0x37, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00,   // U+00FE
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0x38, 0x60, 0x18, 0xE0, 0x18, 0xC0, 0x0C, 0xC0, 0x0D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00,   // U+00FF
+  0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0100
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0101
+  0x18, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0102
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x18, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0103
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x0D, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x38, 0x60, 0x3F, 0xE0, 0x3F, 0xF0, 0x70, 0x70, 0x70, 0x30, 0x60, 0x38, 0xE0, 0x38, 0x00, 0x30, 0x00, 0x60, 0x00, 0x78, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,   // U+0104
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x30, 0xE0, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0xF0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0xF0, 0x3F, 0xF0, 0x1F, 0x70, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,   // U+0105
+  0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x30, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0106
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x20, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x20, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0107
+  0x03, 0xC0, 0x03, 0xC0, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x30, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0108
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x20, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x20, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0109
+  0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x30, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+010A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x20, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x20, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+010B
+  0x04, 0x60, 0x06, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x30, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+010C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x06, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x20, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x20, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+010D
+  0x19, 0x80, 0x1F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x71, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x71, 0xE0, 0x7F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+010E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x60, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+010F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x71, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xFE, 0x70, 0xFE, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x71, 0xE0, 0x7F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0110
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x60, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0111
+  0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0112
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0113
+  0x18, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0114
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x40, 0x0C, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0115
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0116
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0117
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,   // U+0118
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,   // U+0119
+  0x0C, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+011A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x0C, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x30, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x00, 0x30, 0x00, 0x38, 0x30, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+011B
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x3C, 0x20, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x38, 0x30, 0x3C, 0x70, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+011C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x10, 0xE0, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00,   // U+011D
+  0x0C, 0x60, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x3C, 0x20, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x38, 0x30, 0x3C, 0x70, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+011E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x18, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x10, 0xE0, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00,   // U+011F
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x3C, 0x20, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x38, 0x30, 0x3C, 0x70, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0120
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x10, 0xE0, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00,   // U+0121
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x3C, 0x20, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x38, 0x30, 0x3C, 0x70, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00,   // U+0122
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x70, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x10, 0xE0, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00,   // U+0123
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0124
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0125
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xFF, 0xF8, 0xFF, 0xF8, 0x70, 0x70, 0x70, 0x70, 0x7F, 0xF0, 0x7F, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0126
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x30, 0x00, 0x37, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0127
+  0x00, 0x00, 0x0E, 0xC0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0128
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x1B, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0129
+  0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+012A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+012B
+  0x18, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+012C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x18, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+012D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x02, 0x00, 0x06, 0x00, 0x07, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,   // U+012E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x03, 0x00, 0x06, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,   // U+012F
+  0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0130
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0131
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x78, 0xFE, 0x78, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x31, 0x18, 0x31, 0x98, 0xFF, 0xF8, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0132
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x00, 0x00, 0x00, 0x00, 0x79, 0xF8, 0x79, 0xF8, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0xFF, 0x38, 0xFF, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x30, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x00,   // U+0133
+  0x03, 0x80, 0x07, 0x80, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x40, 0xC0, 0x71, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0134
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x00,   // U+0135
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x38, 0x70, 0x70, 0x70, 0xE0, 0x71, 0xC0, 0x73, 0x80, 0x77, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x73, 0x80, 0x71, 0xC0, 0x71, 0xC0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00,   // U+0136
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x70, 0x38, 0xE0, 0x39, 0xC0, 0x3B, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3B, 0x80, 0x39, 0xC0, 0x38, 0xC0, 0x38, 0x60, 0x38, 0x70, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00,   // U+0137
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x70, 0x38, 0xE0, 0x39, 0xC0, 0x3B, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3B, 0x80, 0x39, 0xC0, 0x38, 0xC0, 0x38, 0x60, 0x38, 0x70, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0138
+  0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0139
+  0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+013A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00,   // U+013B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00,   // U+013C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xC0, 0x39, 0xC0, 0x39, 0x80, 0x39, 0x80, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+013D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x30, 0x3E, 0x30, 0x06, 0x30, 0x06, 0x30, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+013E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+013F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x38, 0x06, 0x38, 0x06, 0x38, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0140
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3B, 0x80, 0x3E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0141
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x20, 0x06, 0xE0, 0x07, 0xC0, 0x07, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0x76, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0142
+  0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x78, 0x30, 0x78, 0x30, 0x7C, 0x30, 0x7C, 0x30, 0x76, 0x30, 0x76, 0x30, 0x76, 0x30, 0x73, 0x30, 0x73, 0x30, 0x71, 0xB0, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0143
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0144
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x78, 0x30, 0x78, 0x30, 0x7C, 0x30, 0x7C, 0x30, 0x76, 0x30, 0x76, 0x30, 0x76, 0x30, 0x73, 0x30, 0x73, 0x30, 0x71, 0xB0, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00,   // U+0145
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00,   // U+0146
+  0x0C, 0xC0, 0x07, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x78, 0x30, 0x78, 0x30, 0x7C, 0x30, 0x7C, 0x30, 0x76, 0x30, 0x76, 0x30, 0x76, 0x30, 0x73, 0x30, 0x73, 0x30, 0x71, 0xB0, 0x71, 0xF0, 0x71, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0147
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x0D, 0x80, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0148
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0x00, 0xDD, 0xE0, 0x1F, 0xF0, 0x1E, 0x30, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0149
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xC0, 0x7F, 0xE0, 0x78, 0xE0, 0x78, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x00,   // U+014A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x3F, 0xE0, 0x3C, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x00, 0x00,   // U+014B
+  0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+014C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+014D
+  0x18, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+014E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x18, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+014F
+  0x07, 0x60, 0x06, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0150
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0xC0, 0x0C, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x38, 0xE0, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0151
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xF8, 0x39, 0x80, 0x71, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0xF8, 0x61, 0xF8, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x71, 0x80, 0x39, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0152
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x7F, 0xF0, 0xE7, 0x38, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0xF8, 0xC3, 0xF8, 0xC3, 0x00, 0xC3, 0x00, 0xE7, 0x88, 0x7F, 0xF8, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0153
+  0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x70, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x71, 0xC0, 0x70, 0xE0, 0x70, 0x60, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0154
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x0D, 0xF8, 0x0F, 0x10, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0155
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x70, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x71, 0xC0, 0x70, 0xE0, 0x70, 0x60, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00,   // U+0156
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x0D, 0xF8, 0x0F, 0x10, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00,   // U+0157
+  0x19, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x70, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x71, 0xC0, 0x70, 0xE0, 0x70, 0x60, 0x70, 0x70, 0x70, 0x30, 0x70, 0x38, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0158
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x06, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x0D, 0xF8, 0x0F, 0x10, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0159
+  0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x70, 0x30, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+015A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x38, 0x00, 0x38, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x30, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+015B
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x70, 0x30, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+015C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x38, 0x00, 0x38, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x30, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+015D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x70, 0x30, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x01, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+015E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x38, 0x00, 0x38, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x30, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0x01, 0x00, 0x01, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+015F
+  0x08, 0xC0, 0x0D, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x70, 0x30, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0160
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x0D, 0x80, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x60, 0x38, 0x00, 0x38, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x30, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0161
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x01, 0x00, 0x01, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0162
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x80, 0x00, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,   // U+0163
+  0x0C, 0xC0, 0x0D, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0164
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x0E, 0xC0, 0x0E, 0x00, 0x0E, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0165
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0166
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x0E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0167
+  0x00, 0x00, 0x0E, 0xC0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0168
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x1B, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0169
+  0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+016A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+016B
+  0x18, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+016C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x18, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+016D
+  0x00, 0x00, 0x07, 0x00, 0x0C, 0x80, 0x08, 0xC0, 0x08, 0xC0, 0x7C, 0xF0, 0x77, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+016E
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0C, 0x80, 0x08, 0xC0, 0x08, 0xC0, 0x0C, 0x80, 0x07, 0x80, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+016F
+  0x07, 0x60, 0x06, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0170
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0xC0, 0x0C, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0171
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x06, 0x00, 0x06, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,   // U+0172
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,   // U+0173
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x18, 0xE0, 0x18, 0x67, 0x38, 0x67, 0x38, 0x67, 0x30, 0x67, 0xB0, 0x6D, 0xB0, 0x6D, 0xB0, 0x7D, 0xB0, 0x3C, 0xF0, 0x38, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0174
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0xC0, 0x18, 0xE0, 0x18, 0x60, 0x38, 0x67, 0x30, 0x67, 0x30, 0x67, 0x30, 0x35, 0xB0, 0x3D, 0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0175
+  0x07, 0x00, 0x0D, 0x80, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x70, 0x30, 0x30, 0x70, 0x38, 0xE0, 0x18, 0xC0, 0x1D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0176
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0x38, 0x60, 0x18, 0xE0, 0x18, 0xC0, 0x0C, 0xC0, 0x0D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00,   // U+0177
+  0x00, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x70, 0x30, 0x30, 0x70, 0x38, 0xE0, 0x18, 0xC0, 0x1D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0178
+  0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0179
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+017A
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+017B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+017C
+  0x08, 0xC0, 0x0D, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+017D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x0D, 0x80, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+017E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+017F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2013
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2014
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2018
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2019
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201A
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201B
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x1C, 0xE0, 0x1C, 0xC0, 0x39, 0xC0, 0x39, 0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201C
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x18, 0xC0, 0x19, 0xC0, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201D
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x18, 0xC0, 0x19, 0xC0, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+201E
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2022
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x38, 0x77, 0x38, 0x77, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+2026
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x30, 0x18, 0x00, 0x38, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x30, 0x00, 0x30, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+20AC
+};
+
+struct GlyphSet
+{
+  uint8_t width;        // Cell advance in pixels
+  uint8_t height;       // Cell height in pixels
+  uint8_t stride;       // Bytes per bitmap row
+  const uint8_t *bitmaps;
+};
+
+const GlyphSet glyphSets[GLYPH_SIZES] = {
+  {7, 14, 1, glyphBitmaps1},
+  {13, 27, 2, glyphBitmaps2},
+};
+
+#endif
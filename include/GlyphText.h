@@ -0,0 +1,21 @@
+#ifndef GLYPH_TEXT_H
+#define GLYPH_TEXT_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Text rendering from the pre-rasterized atlas in GlyphAtlas.h.
+// Text is UTF-8, codepoints missing from the atlas are drawn as '?'.
+// Text sizes start at 1, sizes beyond the atlas use the largest one.
+
+int glyphWidth(int textSize);  // Cell advance in pixels
+int glyphHeight(int textSize); // Cell height in pixels
+
+// Draw one codepoint with its top-left corner at x, y
+void drawGlyph(TFT_eSPI &tft, uint32_t codepoint, int x, int y, int textSize, uint16_t textColor, uint16_t bgColor);
+
+// Draw `length` bytes of UTF-8 on a single line, returns the x after the last glyph
+int drawGlyphRun(TFT_eSPI &tft, const char *text, int length, int x, int y, int textSize, uint16_t textColor,
+                 uint16_t bgColor);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef HISTORY_VIEW_H
+#define HISTORY_VIEW_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "MessageHistory.h"
+
+#define HISTORY_LINE_HEIGHT 15 // Pixels per text line, 240 rows divide evenly into lines
+#define HISTORY_SCROLL_STEP 3  // Pixels moved per animation step
+#define HISTORY_STEP_MS 10     // Time between animation steps
+
+// Scrollback of the message history in portrait orientation.
+// Moving through the history uses the ST7789 hardware vertical scroll,
+// so only the line scrolling into view is ever drawn.
+class HistoryView
+{
+public:
+  HistoryView(TFT_eSPI &display, const MessageHistory &messages);
+
+  void begin();                   // Switch to portrait and show the newest messages
+  void end();                     // Leave hardware scrolling and return to landscape
+  bool pageBack();                // Scroll one screen towards older messages, false if already at the oldest
+  void messageAdded();            // A message was pushed, scroll it in if the newest page is shown
+  void update();                  // Advance the scroll animation, call from loop()
+
+  int columns() const;
+
+private:
+  void drawLine(int fromBottom, int lineY, int stripY, int stripHeight);
+  void setScrollStart(int offset);
+
+  TFT_eSPI &tft;
+  const MessageHistory &history;
+  int offset;       // Lines between the bottom row on screen and the newest line
+  int targetOffset; // Where the animation is heading
+  int scroll;       // Hardware scroll offset in pixels, 0..239
+  int progress;     // Pixels already moved towards the next whole line
+  bool forward;     // Direction of the line currently moving, towards newer messages
+  unsigned long lastStep;
+};
+
+#endif
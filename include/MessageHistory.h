@@ -0,0 +1,108 @@
+#ifndef MESSAGE_HISTORY_H
+#define MESSAGE_HISTORY_H
+
+#include <stdint.h>
+#include <string.h>
+#include "Utf8.h"
+
+#define HISTORY_CAPACITY 16     // Number of messages kept, the oldest is overwritten first
+#define HISTORY_MESSAGE_LEN 128 // Longer messages are truncated
+
+// Fixed capacity ring of the most recent messages received from the app.
+// All storage lives in a static arena, pushing a message never touches the heap.
+class MessageHistory
+{
+public:
+  MessageHistory() : head(0), count(0) {}
+
+  // Copy a message into the next slot, overwriting the oldest one when full
+  void push(const char *text, size_t length)
+  {
+    if (length > HISTORY_MESSAGE_LEN - 1)
+    {
+      length = HISTORY_MESSAGE_LEN - 1;
+      while (length > 0 && ((uint8_t)text[length] & 0xC0) == 0x80)
+      {
+        length--; // Don't cut a UTF-8 sequence in half
+      }
+    }
+    memcpy(slots[head], text, length);
+    slots[head][length] = '\0';
+    lengths[head] = (uint8_t)length;
+    head = (head + 1) % HISTORY_CAPACITY;
+    if (count < HISTORY_CAPACITY)
+    {
+      count++;
+    }
+  }
+
+  int size() const { return count; }
+
+  // Message by age, 0 is the newest. Returns an empty string when out of range.
+  const char *get(int age) const
+  {
+    if (age < 0 || age >= count)
+    {
+      return "";
+    }
+    return slots[(head + HISTORY_CAPACITY - 1 - age) % HISTORY_CAPACITY];
+  }
+
+  uint8_t length(int age) const
+  {
+    if (age < 0 || age >= count)
+    {
+      return 0;
+    }
+    return lengths[(head + HISTORY_CAPACITY - 1 - age) % HISTORY_CAPACITY];
+  }
+
+  const char *latest() const { return get(0); }
+
+  // Number of display lines a message takes when wrapped at `columns` characters
+  int linesFor(int age, int columns) const
+  {
+    int characters = utf8Count(get(age), length(age));
+    return (characters == 0) ? 1 : (characters + columns - 1) / columns;
+  }
+
+  // Number of display lines when every message is wrapped at the given column count
+  int lineCount(int columns) const
+  {
+    int lines = 0;
+    for (int age = 0; age < count; age++)
+    {
+      lines += linesFor(age, columns);
+    }
+    return lines;
+  }
+
+  // Find display line `index` (0 is the first line of the oldest message) as a byte range.
+  // Points into the arena, nothing is copied.
+  bool line(int index, int columns, const char **text, int *length) const
+  {
+    for (int age = count - 1; age >= 0; age--)
+    {
+      int lines = linesFor(age, columns);
+      if (index < lines)
+      {
+        const char *message = get(age);
+        const char *end = message + this->length(age);
+        const char *start = utf8Skip(message, end, index * columns);
+        *text = start;
+        *length = utf8Skip(start, end, columns) - start;
+        return true;
+      }
+      index -= lines;
+    }
+    return false;
+  }
+
+private:
+  char slots[HISTORY_CAPACITY][HISTORY_MESSAGE_LEN];
+  uint8_t lengths[HISTORY_CAPACITY];
+  int head;  // Slot the next message goes into
+  int count; // Number of valid slots
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <Arduino.h>
+
+#define RECORD_DIR "/rec"
+#define RECORD_PATH_MAX 24
+#define RECORD_QUEUE_DEPTH 8 // Writer jobs, an open, two segments and a close fit with room to spare
+
+// Session recorder on LittleFS (the "spiffs" partition).
+//
+// Frames are delta compressed into RECORD_SEGMENT_SIZE segments (see
+// lib/RecordFormat/RecordFormat.h) in one of two buffers. A full segment is
+// handed to a low priority task that appends it to /rec/NNNNN.rec while loop()
+// fills the other buffer, so flash erase and program times never hold up
+// acquisition. If the flash falls a whole segment behind, frames are dropped
+// and counted rather than waited for. When the flash fails the writer closes
+// the file at once, recorderFailed() turns true and loop() stops the recording.
+struct RecorderStats
+{
+  uint32_t frames;   // Frames taken into a segment
+  uint32_t segments; // Segments written to flash
+  uint32_t dropped;  // Frames lost because both buffers were busy
+  uint32_t errors;   // Failed opens and writes
+};
+
+bool recorderBegin(); // Mounts the file system, formats it if it won't mount
+bool recorderStart(); // False if already recording or the file system is missing
+void recorderStop();  // Flushes the partial segment and closes the file
+bool recorderActive();    // Recording and the flash keeps up
+bool recorderRecording(); // Started and not stopped yet, even when the flash failed
+bool recorderFailed();    // Still started but the writer gave up, recorderStop() it
+bool recorderWriting(uint16_t number); // Any task, true until the last segment of `number` is on flash and closed
+void recorderAdd(const int16_t *values, uint32_t captureUs); // From loop() for every frame, never blocks
+RecorderStats recorderStats(); // Any task
+
+struct RecordingEntry
+{
+  uint16_t number;
+  uint32_t size;
+};
+
+void recordingPath(uint16_t number, char *path, size_t capacity); // /rec/NNNNN.rec
+// The first `max` recordings numbered above `after`, in order, returns how many
+int recorderList(uint16_t after, RecordingEntry *entries, int max);
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef SESSIONS_H
+#define SESSIONS_H
+
+#include <Arduino.h>
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <esp_gatts_api.h>
+#include <atomic>
+#include "ConnectionTuning.h"
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "PackedFrame.h"
+#include "FrameCodec.h"
+#include "NotifyPacer.h"
+
+#define SESSION_MAX 3                // Centrals connected at once, below the controller's ACL limit
+#define SESSION_DEFAULT_INTERVAL 100 // ms between frames until the app sets a rate
+#define SESSION_STATS_MS 1000        // Stats stream period
+#define SESSION_CODED_BUDGET 10      // Percent of a frame interval that coding may take with every session coded
+
+// What a central receives on the TX characteristic, set with the SUBSCRIBE command
+enum StreamMask : uint8_t
+{
+  STREAM_RAW = 0x01,     // Sensor frames
+  STREAM_LETTERS = 0x02, // Every letter any central sends
+  STREAM_STATS = 0x04,   // Stage timings, pacing and connection info once per SESSION_STATS_MS
+  STREAM_PACKED = 0x08,  // With STREAM_RAW: frames as MSG_PACKED_FRAME (PackedFrame.h) instead of MSG_FRAME
+  STREAM_CODED = 0x10    // With STREAM_RAW: batches as MSG_CODED_FRAMES (FrameCodec.h), lossless, over STREAM_PACKED
+};
+
+// Who owns a session slot. The BLE task takes a free slot on connect and
+// gives it up on disconnect, loop() starts and frees it in sessionsUpdate().
+enum SessionState : uint8_t
+{
+  SESSION_FREE,
+  SESSION_OPENING, // Connected, loop() has not started it yet
+  SESSION_ACTIVE,
+  SESSION_CLOSING  // Disconnected, loop() may still be sending to it
+};
+
+// How the frames of a session's batches go out
+enum BatchFormat : uint8_t
+{
+  BATCH_FRAME,
+  BATCH_PACKED,
+  BATCH_CODED
+};
+
+// One connected central with its own subscriptions, frame rate and pacing.
+// sessionOpen() fills in a free slot before publishing it, after that the
+// BLE task only writes the fields up to `connection`, the rest belongs to loop().
+struct Session
+{
+  std::atomic<uint8_t> state; // SessionState
+  uint16_t connId;
+  esp_bd_addr_t peer;
+  volatile uint16_t mtu;     // Negotiated ATT MTU, a notification carries at most mtu - 3 bytes
+  volatile bool notifying;   // The central enabled notifications in the TX characteristic's CCCD, or had them bonded
+  volatile bool bulkNotifying; // The same for the bulk characteristic (BulkDownload.h)
+  ConnectionInfo connection; // Filled in from the GAP events
+  uint8_t streams;
+  uint16_t intervalMs;
+  uint16_t batchMtu; // MTU the batch size was last limited for
+  uint32_t lastFrameMs;
+  uint32_t lastStatsMs;
+  NotifyPacer pacer;
+  uint8_t batched;     // Frames waiting in `batch`
+  uint8_t batchFormat; // BatchFormat of `batch`, follows STREAM_PACKED and STREAM_CODED
+  uint8_t batch[PROTOCOL_OVERHEAD + PACER_MAX_BATCH * FRAME_PAYLOAD_SIZE]; // MSG_FRAME payloads when coded
+  FrameEncoder encoder; // Each batch of a coded session is one block
+};
+
+extern Session sessions[SESSION_MAX];
+
+// Notifications go straight to esp_ble_gatts_send_indicate for one connection
+// at a time, so each central only gets the streams it asked for, and only
+// once it enabled notifications, on this link or, bonded, on its last one
+// (ConnectionTuning.h). A message longer than the MTU allows is
+// refused rather than cut short by the stack.
+// Also times the coded stream on this chip: when coding a frame for every
+// session would take more than SESSION_CODED_BUDGET percent of
+// `frameIntervalUs`, STREAM_CODED sessions get their frames uncoded.
+void sessionsBegin(BLEServer *server, BLECharacteristic *tx, uint32_t frameIntervalUs);
+
+// BLE task
+Session *sessionOpen(uint16_t connId, const esp_bd_addr_t peer); // NULL when all slots are taken
+void sessionClose(uint16_t connId);
+void sessionMtuChanged(uint16_t connId, uint16_t mtu);
+
+// Any task, connected sessions only (opening or active)
+Session *sessionFind(uint16_t connId);
+Session *sessionFindPeer(const esp_bd_addr_t peer);
+int sessionCount();
+
+// loop(): start the sessions that opened and let go of the ones that closed
+void sessionsUpdate();
+
+// Seal a message whose payload was written at messagePayload(buffer) and send it to one central
+bool sessionNotify(Session &session, uint8_t *buffer, size_t capacity, MessageType type, size_t payloadLength);
+// Seal once, send to every central subscribed to one of `streams`
+void sessionsNotify(uint8_t streams, uint8_t *buffer, size_t capacity, MessageType type, size_t payloadLength);
+
+// Encode a frame once and hand it to every raw subscriber whose rate makes it due
+void sessionsPublishFrame(const int16_t *values, uint32_t captureUs);
+
+// Notification completion and congestion, call from the custom GATT server handler
+void sessionsGattsEvent(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf, esp_ble_gatts_cb_param_t *param);
+
+#endif
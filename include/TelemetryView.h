@@ -0,0 +1,32 @@
+#ifndef TELEMETRY_VIEW_H
+#define TELEMETRY_VIEW_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "GlovePipeline.h"
+
+#define TELEMETRY_FRAME_MS 66 // Cap the telemetry view at ~15 frames per second
+
+// Live view of every flex bend (FLEX_COUNT bars) and the hand orientation.
+// Only the part of a bar that changed since the last frame is redrawn,
+// the screen is never cleared while the view is active.
+class TelemetryView
+{
+public:
+  TelemetryView(TFT_eSPI &display);
+
+  void begin();                     // Clear the main area and draw the static layout
+  void update(const int16_t *data); // Draw the deltas for a dataArray frame (rate limited)
+
+private:
+  void drawBar(int finger, int angle);
+  void drawOrientation(int16_t accelX, int16_t accelY);
+
+  TFT_eSPI &tft;
+  int barHeight[FLEX_COUNT]; // Bar heights currently on screen, in pixels
+  int dotX;               // Orientation dot currently on screen
+  int dotY;
+  unsigned long lastFrame;
+};
+
+#endif
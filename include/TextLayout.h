@@ -0,0 +1,44 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <stdint.h>
+#include <string.h>
+#include "Utf8.h"
+
+// Where drawWrappedText puts each glyph, without drawing anything, so the
+// layout also runs in the host benchmarks. Text is UTF-8 in fixed width
+// cells starting at x, y. A glyph that would cross the right edge starts a
+// new line at x; a line that would cross the bottom starts over at y, and
+// `place` is told to clear the screen first.
+//
+// place(codepoint, x, y, clear) is called once per glyph, in order.
+template <typename Place>
+inline void layoutWrapped(const char *text, int x, int y, int width, int height, int charWidth, int lineHeight,
+                          Place &&place)
+{
+  int cursorX = x;
+  int cursorY = y;
+  const char *end = text + strlen(text);
+
+  while (text < end)
+  {
+    uint32_t codepoint = utf8Next(text, end);
+    bool clear = false;
+
+    if (cursorX + charWidth > width)
+    {
+      cursorX = x;
+      cursorY += lineHeight;
+    }
+    if (cursorY + lineHeight > height)
+    {
+      cursorY = y;
+      clear = true;
+    }
+
+    place(codepoint, cursorX, cursorY, clear);
+    cursorX += charWidth;
+  }
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stdint.h>
+
+#define UTF8_REPLACEMENT 0xFFFD // Substituted for malformed sequences
+
+// Decode the codepoint at `text` and advance past it.
+// Malformed or truncated sequences consume one byte and give U+FFFD.
+inline uint32_t utf8Next(const char *&text, const char *end)
+{
+  uint8_t lead = (uint8_t)*text++;
+  if (lead < 0x80)
+  {
+    return lead;
+  }
+
+  int extra;
+  uint32_t codepoint;
+  if ((lead & 0xE0) == 0xC0)
+  {
+    extra = 1;
+    codepoint = lead & 0x1F;
+  }
+  else if ((lead & 0xF0) == 0xE0)
+  {
+    extra = 2;
+    codepoint = lead & 0x0F;
+  }
+  else if ((lead & 0xF8) == 0xF0)
+  {
+    extra = 3;
+    codepoint = lead & 0x07;
+  }
+  else
+  {
+    return UTF8_REPLACEMENT; // Stray continuation byte or invalid lead
+  }
+
+  if (end - text < extra)
+  {
+    return UTF8_REPLACEMENT;
+  }
+  for (int i = 0; i < extra; i++)
+  {
+    uint8_t next = (uint8_t)text[i];
+    if ((next & 0xC0) != 0x80)
+    {
+      return UTF8_REPLACEMENT;
+    }
+    codepoint = (codepoint << 6) | (next & 0x3F);
+  }
+
+  // Reject overlong encodings and surrogates
+  static const uint32_t minimum[4] = {0, 0x80, 0x800, 0x10000};
+  if (codepoint < minimum[extra] || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+  {
+    return UTF8_REPLACEMENT;
+  }
+  text += extra;
+  return codepoint;
+}
+
+// Number of codepoints in `length` bytes of text
+inline int utf8Count(const char *text, int length)
+{
+  const char *end = text + length;
+  int count = 0;
+  while (text < end)
+  {
+    utf8Next(text, end);
+    count++;
+  }
+  return count;
+}
+
+// Skip `count` codepoints, stopping at `end`
+inline const char *utf8Skip(const char *text, const char *end, int count)
+{
+  while (count-- > 0 && text < end)
+  {
+    utf8Next(text, end);
+  }
+  return text;
+}
+
+#endif
@@ -0,0 +1,127 @@
+#include "BinLog.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+LogRing logRing;
+
+LogRing::LogRing() : head(0), tail(0), dropped(0)
+{
+  for (uint32_t i = 0; i < BINLOG_RING_SIZE; i++)
+  {
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool LogRing::push(const LogRecord &record)
+{
+  uint32_t position = head.load(std::memory_order_relaxed);
+  for (;;)
+  {
+    Slot &slot = slots[position & (BINLOG_RING_SIZE - 1)];
+    uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+    int32_t difference = (int32_t)(sequence - position);
+    if (difference == 0)
+    {
+      // Slot is free for this position, claim it
+      if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        slot.record = record;
+        slot.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    }
+    else if (difference < 0)
+    {
+      dropped.fetch_add(1, std::memory_order_relaxed); // Ring full, never wait
+      return false;
+    }
+    else
+    {
+      position = head.load(std::memory_order_relaxed); // Another producer got there first
+    }
+  }
+}
+
+bool LogRing::pop(LogRecord *record)
+{
+  Slot &slot = slots[tail & (BINLOG_RING_SIZE - 1)];
+  uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+  if (sequence != tail + 1)
+  {
+    return false; // Empty, or the producer hasn't finished writing
+  }
+  *record = slot.record;
+  slot.sequence.store(tail + BINLOG_RING_SIZE, std::memory_order_release);
+  tail++;
+  return true;
+}
+
+uint32_t LogRing::takeDropped()
+{
+  return dropped.exchange(0, std::memory_order_relaxed);
+}
+
+uint32_t binlogTimestampUs()
+{
+#ifdef ARDUINO
+  return (uint32_t)esp_timer_get_time();
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+size_t binlogEncode(const LogRecord &record, uint8_t *out)
+{
+  const uint8_t *bytes = (const uint8_t *)&record;
+  uint8_t checksum = 0;
+  out[0] = BINLOG_SYNC;
+  for (size_t i = 0; i < sizeof(LogRecord); i++)
+  {
+    out[1 + i] = bytes[i];
+    checksum ^= bytes[i];
+  }
+  out[1 + sizeof(LogRecord)] = checksum;
+  return BINLOG_WIRE_SIZE;
+}
+
+#ifdef ARDUINO
+
+#define BINLOG_DRAIN_IDLE_MS 20 // Sleep when the ring is empty
+
+static void binlogDrainTask(void *)
+{
+  uint8_t wire[BINLOG_WIRE_SIZE];
+  LogRecord record;
+  for (;;)
+  {
+    uint32_t lost = logRing.takeDropped();
+    if (lost > 0)
+    {
+      BINLOG(RING_OVERFLOW, lost);
+    }
+    while (logRing.pop(&record))
+    {
+      Serial.write(wire, binlogEncode(record, wire)); // Blocks only this task when the UART is busy
+    }
+    vTaskDelay(pdMS_TO_TICKS(BINLOG_DRAIN_IDLE_MS));
+  }
+}
+
+void binlogBegin()
+{
+  xTaskCreate(binlogDrainTask, "binlog", 3072, NULL, 1, NULL); // Just above idle
+}
+
+#else
+
+void binlogBegin()
+{
+}
+
+#endif
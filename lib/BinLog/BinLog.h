@@ -0,0 +1,133 @@
+#ifndef BIN_LOG_H
+#define BIN_LOG_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// Binary logging: hot paths write fixed size records (id, timestamp, args)
+// into a lock-free ring, a low priority task drains it to the UART and
+// tools/logdecode turns the stream back into text.
+//
+// Messages are declared in LogMessages.h. Records below BINLOG_LEVEL are
+// removed at compile time, arguments included; build production firmware
+// with -DBINLOG_LEVEL=BINLOG_LEVEL_NONE and logging costs nothing.
+
+#define BINLOG_LEVEL_DEBUG 0
+#define BINLOG_LEVEL_INFO 1
+#define BINLOG_LEVEL_WARN 2
+#define BINLOG_LEVEL_ERROR 3
+#define BINLOG_LEVEL_NONE 4
+
+#ifndef BINLOG_LEVEL
+#define BINLOG_LEVEL BINLOG_LEVEL_INFO
+#endif
+
+#define BINLOG_MAX_ARGS 4
+#define BINLOG_RING_SIZE 256 // Records, power of two
+#define BINLOG_SYNC 0xA5     // First byte of every record on the wire
+
+#include "LogMessages.h"
+
+enum LogId : uint16_t
+{
+#define BINLOG_ID(name, level, format) LOG_##name,
+  GLOVE_LOG_MESSAGES(BINLOG_ID)
+#undef BINLOG_ID
+  LOG_ID_COUNT
+};
+
+namespace binlog
+{
+  struct LogLevels
+  {
+#define BINLOG_LEVEL_OF(name, level, format) static constexpr uint8_t name = level;
+    GLOVE_LOG_MESSAGES(BINLOG_LEVEL_OF)
+#undef BINLOG_LEVEL_OF
+  };
+}
+
+// One record as stored in the ring and sent on the wire (little endian)
+struct LogRecord
+{
+  uint16_t id;
+  uint8_t level;
+  uint8_t argc;
+  uint32_t timestampUs;
+  int32_t args[BINLOG_MAX_ARGS];
+};
+
+#define BINLOG_WIRE_SIZE (2 + sizeof(LogRecord)) // Sync byte, record, checksum
+
+// Bounded multi-producer single-consumer ring (Vyukov style sequence per slot).
+// Producers never block: a full ring drops the record and counts it.
+class LogRing
+{
+public:
+  LogRing();
+
+  bool push(const LogRecord &record);
+  bool pop(LogRecord *record); // Single consumer only
+  uint32_t takeDropped();      // Records dropped since the last call
+
+private:
+  struct Slot
+  {
+    std::atomic<uint32_t> sequence;
+    LogRecord record;
+  };
+
+  Slot slots[BINLOG_RING_SIZE];
+  std::atomic<uint32_t> head;
+  uint32_t tail;
+  std::atomic<uint32_t> dropped;
+};
+
+extern LogRing logRing;
+
+uint32_t binlogTimestampUs();
+
+// Serialize a record for the wire: sync byte, record, XOR checksum of the record bytes
+size_t binlogEncode(const LogRecord &record, uint8_t *out);
+
+// Start the task that drains the ring to the serial port (firmware only)
+void binlogBegin();
+
+namespace binlog
+{
+  inline int32_t toArg(float value)
+  {
+    int32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+  inline int32_t toArg(double value) { return toArg((float)value); }
+  template <typename T>
+  inline int32_t toArg(T value) { return (int32_t)value; }
+
+  template <typename... Args>
+  inline void write(LogId id, uint8_t level, Args... args)
+  {
+    static_assert(sizeof...(Args) <= BINLOG_MAX_ARGS, "too many log arguments");
+    LogRecord record;
+    record.id = id;
+    record.level = level;
+    record.argc = sizeof...(Args);
+    record.timestampUs = binlogTimestampUs();
+    int32_t values[BINLOG_MAX_ARGS + 1] = {toArg(args)...};
+    memcpy(record.args, values, sizeof(record.args));
+    logRing.push(record);
+  }
+}
+
+// BINLOG(NAME, args...) logs message LOG_NAME from LogMessages.h
+#define BINLOG(name, ...)                                                       \
+  do                                                                            \
+  {                                                                             \
+    if (binlog::LogLevels::name >= BINLOG_LEVEL)                                \
+    {                                                                           \
+      binlog::write(LOG_##name, binlog::LogLevels::name, ##__VA_ARGS__);        \
+    }                                                                           \
+  } while (0)
+
+#endif
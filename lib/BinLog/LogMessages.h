@@ -0,0 +1,47 @@
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+
+// Every binary log message, shared by the firmware and the host decoder.
+// X(name, level, format): up to BINLOG_MAX_ARGS arguments, %f arguments are sent as float bits.
+// Append new messages at the end so ids of older captures still decode.
+#define GLOVE_LOG_MESSAGES(X)                                                      \
+  X(BOOT, BINLOG_LEVEL_INFO, "Starting BLE work!")                                 \
+  X(MPU_MISSING, BINLOG_LEVEL_ERROR, "Failed to find MPU6050 chip")                \
+  X(MPU_FOUND, BINLOG_LEVEL_INFO, "MPU6050 Found!")                                \
+  X(ADVERTISING, BINLOG_LEVEL_INFO, "Bluetooth device active, waiting for connections...") \
+  X(CONNECTED, BINLOG_LEVEL_INFO, "Central %u connected, %u sessions")             \
+  X(DISCONNECTED, BINLOG_LEVEL_INFO, "Central %u disconnected, %u sessions")       \
+  X(APP_WRITE, BINLOG_LEVEL_INFO, "Received %u byte letter from app")              \
+  X(BUTTON, BINLOG_LEVEL_DEBUG, "Button event %d -> action %d")                    \
+  X(FLEX_ANGLES, BINLOG_LEVEL_DEBUG, "Flex %d %d %d %d")                           \
+  X(FLEX_PINKY, BINLOG_LEVEL_DEBUG, "Flex pinky %d")                               \
+  X(GYRO, BINLOG_LEVEL_DEBUG, "Gyro %.2f %.2f %.2f")                               \
+  X(ACCEL, BINLOG_LEVEL_DEBUG, "Accel %.2f %.2f %.2f")                             \
+  X(NOTIFY, BINLOG_LEVEL_DEBUG, "Sent data array to app (%u bytes)")               \
+  X(CALIBRATED, BINLOG_LEVEL_INFO, "Calibration complete")                         \
+  X(RING_OVERFLOW, BINLOG_LEVEL_WARN, "%u log records dropped")                    \
+  X(BAD_MESSAGE, BINLOG_LEVEL_WARN, "Dropped app write: protocol status %d, %u bytes") \
+  X(UNHANDLED_MESSAGE, BINLOG_LEVEL_WARN, "No handler for message type %u (%u bytes)") \
+  X(COMMAND, BINLOG_LEVEL_INFO, "Command %u, value %u")                            \
+  X(BAD_COMMAND, BINLOG_LEVEL_WARN, "Rejected command %u: status %d")              \
+  X(PACING, BINLOG_LEVEL_INFO, "Pacing central %u: %u frames per notification, 1 in %u frames, %u B/s") \
+  X(CONN_PARAMS, BINLOG_LEVEL_INFO, "Connection update status %d: interval %u x1.25 ms, latency %u, timeout %u x10 ms") \
+  X(CONN_DATA_LENGTH, BINLOG_LEVEL_INFO, "Data length status %d: tx %u rx %u octets") \
+  X(CONN_PHY, BINLOG_LEVEL_INFO, "PHY update status %d: tx %u rx %u")              \
+  X(CONN_SECURED, BINLOG_LEVEL_INFO, "Encryption %d after %u ms (reason %d)")      \
+  X(RECONNECTED, BINLOG_LEVEL_INFO, "Reconnected %u ms after the disconnect")     \
+  X(RECORD_START, BINLOG_LEVEL_INFO, "Recording %u started")                       \
+  X(RECORD_STOP, BINLOG_LEVEL_INFO, "Recording %u stopped: %u frames, %u segments, %u dropped") \
+  X(RECORD_ERROR, BINLOG_LEVEL_ERROR, "Recording %u: flash open or write failed") \
+  X(BULK_OPEN, BINLOG_LEVEL_INFO, "Download of recording %u from offset %u, window %u x %u B") \
+  X(BULK_DONE, BINLOG_LEVEL_INFO, "Download of recording %u done: %u bytes in %u ms, %u resent") \
+  X(BULK_ERROR, BINLOG_LEVEL_WARN, "Bulk request %u failed: error %u")             \
+  X(TEXT_DROPPED, BINLOG_LEVEL_WARN, "Dropped %u bytes of text, every text slot is taken") \
+  X(FRAMES_REFUSED, BINLOG_LEVEL_WARN, "Central %u: MTU %u is too small for one frame, frames held back") \
+  X(FLEX_ANGLE, BINLOG_LEVEL_DEBUG, "Flex %u: %d")                                 \
+  X(IMU_GYRO, BINLOG_LEVEL_DEBUG, "IMU %u gyro %.2f %.2f %.2f")                    \
+  X(IMU_ACCEL, BINLOG_LEVEL_DEBUG, "IMU %u accel %.2f %.2f %.2f")                 \
+  X(CODED_BUDGET, BINLOG_LEVEL_INFO, "Coding takes %u cycles per frame, budget %u per session") \
+  X(CODED_OFF, BINLOG_LEVEL_WARN, "Coded stream off: %u cycles per frame is over the budget of %u, sending frames uncoded")
+
+#endif
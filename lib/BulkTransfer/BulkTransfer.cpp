@@ -0,0 +1,124 @@
+#include "BulkTransfer.h"
+
+void BulkSender::begin(uint32_t fileSize, uint32_t offset, uint8_t chunks, uint16_t chunkSize, uint32_t now)
+{
+  size = fileSize;
+  acked = offset < fileSize ? offset : fileSize;
+  nextOffset = acked;
+  lastAckMs = now;
+  rewound = 0;
+  chunk = chunkSize;
+  window = chunks;
+}
+
+bool BulkSender::next(uint32_t *offset, uint16_t *length, uint32_t now)
+{
+  if (done() || chunk == 0)
+  {
+    return false;
+  }
+  if (nextOffset > acked && (now - lastAckMs) >= BULK_TIMEOUT_MS)
+  {
+    // Nothing heard for a while, the ACK or the chunks after it were lost
+    rewound += nextOffset - acked;
+    nextOffset = acked;
+    lastAckMs = now;
+  }
+  if (nextOffset >= size || nextOffset - acked >= (uint32_t)window * chunk)
+  {
+    return false;
+  }
+  uint32_t left = size - nextOffset;
+  *offset = nextOffset;
+  *length = left < chunk ? (uint16_t)left : chunk;
+  return true;
+}
+
+void BulkSender::sent(uint16_t length)
+{
+  nextOffset += length;
+}
+
+void BulkSender::ack(uint32_t offset, uint8_t flags, uint32_t now)
+{
+  if (offset > size)
+  {
+    return; // Not an offset of this file
+  }
+  if (offset > acked)
+  {
+    acked = offset;
+    lastAckMs = now;
+  }
+  if (nextOffset < acked)
+  {
+    nextOffset = acked; // Chunks resent after a timeout had already arrived
+  }
+  if ((flags & BULK_ACK_REWIND) && offset == acked && nextOffset > acked)
+  {
+    rewound += nextOffset - acked;
+    nextOffset = acked;
+    lastAckMs = now;
+  }
+}
+
+void BulkReceiver::begin(uint32_t fileSize, uint32_t offset, uint8_t chunks)
+{
+  size = fileSize;
+  expected = offset;
+  highest = offset;
+  resendTo = offset;
+  window = chunks;
+  sinceAck = 0;
+  gap = false;
+  rewinding = false;
+  stale = false;
+}
+
+bool BulkReceiver::accept(uint32_t offset, uint16_t length)
+{
+  if (offset == expected && length > 0)
+  {
+    expected += length;
+    sinceAck++;
+    gap = false;
+    rewinding = false;
+    return true;
+  }
+  if (offset < expected)
+  {
+    stale = true;
+    return false;
+  }
+  // The link keeps order, so after a rewind a chunk at or below the furthest one
+  // seen before it is a resend, and the resent `expected` was lost as well
+  if (!rewinding || offset <= resendTo)
+  {
+    gap = true;
+  }
+  if (offset > highest)
+  {
+    highest = offset;
+  }
+  return false;
+}
+
+bool BulkReceiver::ackDue(uint32_t *offset, uint8_t *flags)
+{
+  *offset = expected;
+  *flags = 0;
+  if (gap)
+  {
+    *flags = BULK_ACK_REWIND;
+    gap = false;
+    rewinding = true;
+    resendTo = highest;
+  }
+  else if (!stale && sinceAck < (window > 1 ? window / 2 : 1) && !(done() && sinceAck > 0))
+  {
+    return false;
+  }
+  sinceAck = 0;
+  stale = false;
+  return true;
+}
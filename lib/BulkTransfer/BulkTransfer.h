@@ -0,0 +1,120 @@
+#ifndef BULK_TRANSFER_H
+#define BULK_TRANSFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Windowed file download over the bulk characteristic, shared by the firmware and the host tools.
+//
+// Every value is a MSG_BULK message (see GloveProtocol.h) whose payload starts with an op byte:
+//
+//   central -> glove
+//     LIST    u16 list recordings numbered above this
+//     OPEN    u16 recording, u32 offset to resume from, u8 window in chunks
+//     ACK     u32 offset, every byte below it arrived; u8 flags, BULK_ACK_REWIND resends from it
+//     CLOSE   no arguments
+//
+//   glove -> central
+//     ENTRIES u8 count, then count x (u16 recording, u32 size)
+//     INFO    u16 recording, u32 size, u32 offset, u16 data bytes per chunk
+//     DATA    u32 offset, then the file bytes
+//     ERROR   u8 BulkError
+//
+// The glove keeps up to `window` chunks unacknowledged and slides on every
+// ACK, so the link stays full instead of waiting a round trip per chunk. The
+// receiver acks every half window, and asks for a rewind when a chunk goes
+// missing (go-back-N). A download that was cut off is resumed by opening
+// the same recording at the offset already saved.
+
+#define BULK_DATA_HEADER 5      // Op and offset in front of the file bytes
+#define BULK_MAX_WINDOW 32      // Chunks
+#define BULK_DEFAULT_WINDOW 16
+#define BULK_TIMEOUT_MS 1000    // Without an ACK the glove resends from the last acked offset
+#define BULK_MAX_ENTRIES 32     // Recordings per ENTRIES reply
+#define BULK_ACK_REWIND 0x01
+
+// X(name, op). Ops are part of the wire format, never renumber them.
+#define BULK_OPS(X)    \
+  X(LIST, 0x01)        \
+  X(OPEN, 0x02)        \
+  X(ACK, 0x03)         \
+  X(CLOSE, 0x04)       \
+  X(ENTRIES, 0x81)     \
+  X(INFO, 0x82)        \
+  X(DATA, 0x83)        \
+  X(ERROR, 0x84)
+
+enum BulkOp : uint8_t
+{
+#define BULK_OP_ENUM(name, op) BULK_##name = op,
+  BULK_OPS(BULK_OP_ENUM)
+#undef BULK_OP_ENUM
+};
+
+enum BulkError : uint8_t
+{
+  BULK_ERROR_NOT_FOUND = 1,
+  BULK_ERROR_BUSY,        // Another central is downloading, or the recording is still being written
+  BULK_ERROR_BAD_REQUEST,
+  BULK_ERROR_READ_FAILED
+};
+
+// Data bytes per chunk for a notification payload of `maxPayload` bytes
+inline uint16_t bulkChunkSize(size_t maxPayload)
+{
+  return maxPayload > BULK_DATA_HEADER ? (uint16_t)(maxPayload - BULK_DATA_HEADER) : 0;
+}
+
+// Decides which bytes the glove sends next. Knows nothing about files or BLE,
+// the caller reads and sends the chunk and reports back.
+class BulkSender
+{
+public:
+  void begin(uint32_t size, uint32_t offset, uint8_t window, uint16_t chunkSize, uint32_t now);
+
+  // Next chunk to send while the window has room, resends after a timeout
+  bool next(uint32_t *offset, uint16_t *length, uint32_t now);
+  void sent(uint16_t length); // The chunk from next() went out, anything else means it's retried
+  void ack(uint32_t offset, uint8_t flags, uint32_t now);
+
+  bool done() const { return acked >= size; }
+  uint32_t ackedOffset() const { return acked; }
+  uint32_t resent() const { return rewound; }
+
+private:
+  uint32_t size;
+  uint32_t acked;      // Everything below arrived
+  uint32_t nextOffset; // First byte not sent yet
+  uint32_t lastAckMs;
+  uint32_t rewound;    // Bytes sent again after a rewind or timeout
+  uint16_t chunk;
+  uint8_t window;
+};
+
+// Puts the chunks back in order on the central and says when to ack
+class BulkReceiver
+{
+public:
+  void begin(uint32_t size, uint32_t offset, uint8_t window);
+
+  // True when the chunk is the next one in order and should be stored
+  bool accept(uint32_t offset, uint16_t length);
+  // True when an ACK should go out now, with the offset and flags to send
+  bool ackDue(uint32_t *offset, uint8_t *flags);
+
+  bool done() const { return expected >= size; }
+  uint32_t received() const { return expected; }
+
+private:
+  uint32_t size;
+  uint32_t expected; // Next byte wanted
+  uint32_t highest;  // Furthest chunk seen past a gap
+  uint32_t resendTo; // Chunks up to here after a rewind can only be resends
+  uint8_t window;
+  uint8_t sinceAck;  // In-order chunks since the last ACK
+  bool gap;          // A chunk went missing and no rewind was asked for yet
+  bool rewinding;    // Rewind asked for, waiting for `expected` to show up again
+  bool stale;        // A chunk arrived twice, the glove missed an ACK
+};
+
+#endif
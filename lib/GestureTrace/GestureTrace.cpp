@@ -0,0 +1,293 @@
+#include "GestureTrace.h"
+#include <math.h>
+#include <string.h>
+
+#define GRAVITY 9.80665f
+#define DEG (float)(M_PI / 180.0)
+
+enum Motion : uint8_t
+{
+  STILL,
+  TWIST,  // J: the pinky draws a hook, the wrist rolls over
+  ZIGZAG  // Z: the index draws a Z, the wrist swings left and right while dropping
+};
+
+// Fingerspelled hand shapes: thumb, index, middle, ring, pinky in degrees
+// (0 straight, 90 fully bent) and the wrist orientation. Several letters
+// share a shape the flex sensors can't tell apart (U and V, G and Q apart
+// from the wrist), which is what a real glove sees as well.
+struct Shape
+{
+  int8_t flex[FLEX_COUNT];
+  int8_t rollDeg, pitchDeg;
+  Motion motion;
+};
+
+static const Shape letterShapes[26] = {
+    {{20, 90, 90, 90, 90}, 0, 0, STILL},     // A
+    {{70, 0, 0, 0, 0}, 0, 0, STILL},         // B
+    {{40, 45, 45, 45, 45}, 30, 0, STILL},    // C
+    {{50, 0, 70, 70, 70}, 0, 0, STILL},      // D
+    {{80, 75, 75, 75, 75}, 0, 0, STILL},     // E
+    {{45, 60, 0, 0, 0}, 0, 0, STILL},        // F
+    {{10, 0, 90, 90, 90}, 80, 0, STILL},     // G
+    {{60, 0, 0, 90, 90}, 80, 0, STILL},      // H
+    {{70, 90, 90, 90, 0}, 0, 0, STILL},      // I
+    {{70, 90, 90, 90, 0}, 0, 0, TWIST},      // J
+    {{30, 0, 30, 90, 90}, 0, 0, STILL},      // K
+    {{0, 0, 90, 90, 90}, 0, 0, STILL},       // L
+    {{80, 80, 80, 80, 90}, 0, 10, STILL},    // M
+    {{80, 80, 80, 90, 90}, 0, 10, STILL},    // N
+    {{50, 60, 60, 60, 60}, 20, 0, STILL},    // O
+    {{30, 0, 30, 90, 90}, 0, -60, STILL},    // P
+    {{10, 0, 90, 90, 90}, 0, -60, STILL},    // Q
+    {{70, 10, 10, 90, 90}, 0, 0, STILL},     // R
+    {{60, 90, 90, 90, 90}, 0, 0, STILL},     // S
+    {{60, 75, 90, 90, 90}, 0, 0, STILL},     // T
+    {{70, 0, 0, 90, 90}, 0, 0, STILL},       // U
+    {{65, 0, 5, 90, 90}, 0, 0, STILL},       // V
+    {{70, 0, 0, 0, 90}, 0, 0, STILL},        // W
+    {{70, 50, 90, 90, 90}, 0, 0, STILL},     // X
+    {{0, 90, 90, 90, 0}, 0, 0, STILL},       // Y
+    {{70, 0, 90, 90, 90}, 0, 0, ZIGZAG},     // Z
+};
+
+static const Shape restShape = {{15, 15, 15, 15, 15}, 0, 20, STILL}; // Relaxed hand between words
+
+static const Shape &shapeOf(char letter)
+{
+  if (letter >= 'a' && letter <= 'z')
+  {
+    letter = (char)(letter - 'a' + 'A');
+  }
+  return letter >= 'A' && letter <= 'Z' ? letterShapes[letter - 'A'] : restShape;
+}
+
+static float smoothstep(float t)
+{
+  t = t < 0 ? 0 : (t > 1 ? 1 : t);
+  return t * t * (3 - 2 * t);
+}
+
+TraceConfig traceDefaults(uint32_t seed, const char *text)
+{
+  TraceConfig config;
+  memset(&config, 0, sizeof(config));
+  config.seed = seed;
+  config.text = text;
+  config.rateHz = 100;
+  config.holdMs = 600;
+  config.transitionMs = 250;
+  config.shapeJitterDeg = 5;
+  config.adcNoise = 3;
+  config.gyroNoise = 0.02f;
+  config.accelNoise = 0.05f;
+  config.adcDrift = 0.5f;
+  config.gyroDrift = 0.002f;
+  config.dropoutsPerMin = 1;
+  return config;
+}
+
+// splitmix64, small and the same on every host
+uint32_t GestureTrace::random()
+{
+  uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return (uint32_t)((z ^ (z >> 31)) >> 32);
+}
+
+float GestureTrace::uniform()
+{
+  return (random() >> 8) * (1.0f / 16777216.0f);
+}
+
+// Box-Muller, one of the pair is thrown away to keep the stream simple
+float GestureTrace::gaussian()
+{
+  float u = uniform();
+  float v = uniform();
+  return sqrtf(-2.0f * logf(1.0f - u)) * cosf(2.0f * (float)M_PI * v);
+}
+
+void GestureTrace::begin(const TraceConfig &traceConfig)
+{
+  config = traceConfig;
+  state = config.seed;
+  frame = 0;
+  periodS = 1.0f / config.rateHz;
+  textIndex = 0;
+  spelled = 0;
+  letterFrame = 0;
+  memset(adcOffset, 0, sizeof(adcOffset));
+  memset(gyroBias, 0, sizeof(gyroBias));
+  flexDropout = -1;
+  dropoutFrames = 0;
+  imuDropout = false;
+  memset(lastGyro, 0, sizeof(lastGyro));
+  memset(lastAccel, 0, sizeof(lastAccel));
+
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    to.flex[i] = restShape.flex[i];
+  }
+  to.roll = restShape.rollDeg * DEG;
+  to.pitch = restShape.pitchDeg * DEG;
+  to.yaw = 0;
+  letter = ' ';
+  startLetter();
+  last = current();
+}
+
+// Moves on to the next character of the text, starting from wherever the hand is now
+void GestureTrace::startLetter()
+{
+  from = letterFrame > 0 ? current() : to;
+  const char *text = config.text && config.text[0] ? config.text : " ";
+  if (text[textIndex] == '\0')
+  {
+    textIndex = 0;
+  }
+  letter = text[textIndex++];
+  if ((letter >= 'a' && letter <= 'z') || (letter >= 'A' && letter <= 'Z'))
+  {
+    letter = (char)(letter & ~0x20);
+    spelled++;
+  }
+  else
+  {
+    letter = ' ';
+  }
+
+  const Shape &shape = shapeOf(letter);
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    float angle = shape.flex[i] + gaussian() * config.shapeJitterDeg;
+    to.flex[i] = angle < 0 ? 0 : (angle > 90 ? 90 : angle);
+  }
+  to.roll = (shape.rollDeg + gaussian() * 5) * DEG;
+  to.pitch = (shape.pitchDeg + gaussian() * 5) * DEG;
+  to.yaw = gaussian() * 5 * DEG;
+
+  float framesPerMs = config.rateHz / 1000.0f;
+  transitionFrames = (uint32_t)(config.transitionMs * framesPerMs) + 1;
+  holdFrames = (uint32_t)(config.holdMs * (0.75f + 0.5f * uniform()) * framesPerMs) + 1;
+  letterFrame = 0;
+}
+
+GestureTrace::Pose GestureTrace::current() const
+{
+  Pose pose;
+  float t = smoothstep((float)letterFrame / transitionFrames);
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    pose.flex[i] = from.flex[i] + (to.flex[i] - from.flex[i]) * t;
+  }
+  pose.roll = from.roll + (to.roll - from.roll) * t;
+  pose.pitch = from.pitch + (to.pitch - from.pitch) * t;
+  pose.yaw = from.yaw + (to.yaw - from.yaw) * t;
+
+  if (letterFrame > transitionFrames)
+  {
+    float h = (float)(letterFrame - transitionFrames) / holdFrames; // 0..1 over the hold
+    switch (shapeOf(letter).motion)
+    {
+    case TWIST:
+      pose.roll += 90 * DEG * smoothstep(h);
+      pose.pitch -= 20 * DEG * sinf((float)M_PI * h);
+      break;
+    case ZIGZAG:
+    {
+      float stroke = h * 3; // Across, diagonally back, across
+      float across = stroke < 1 ? stroke : (stroke < 2 ? 2 - stroke : stroke - 2);
+      pose.yaw += (across - 0.5f) * 40 * DEG;
+      pose.pitch -= 25 * DEG * smoothstep(stroke - 1); // Down on the diagonal
+      break;
+    }
+    default:
+      break;
+    }
+  }
+  return pose;
+}
+
+void GestureTrace::next(SensorSample *sample)
+{
+  if (letterFrame >= transitionFrames + holdFrames)
+  {
+    startLetter();
+  }
+  Pose pose = current();
+  sample->timeUs = (uint32_t)(uint64_t)(frame * 1e6 / config.rateHz); // Wraps like the glove clock
+  sample->letter = letter;
+  sample->holding = letterFrame >= transitionFrames;
+
+  // Slow drift, a random walk scaled to the frame period
+  float step = sqrtf(periodS);
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    adcOffset[i] += gaussian() * config.adcDrift * step;
+  }
+  for (int i = 0; i < 3; i++)
+  {
+    gyroBias[i] += gaussian() * config.gyroDrift * step;
+  }
+
+  // Dropouts: one sensor or the IMU for up to TRACE_DROPOUT_MAX_MS
+  if (dropoutFrames == 0 && uniform() < config.dropoutsPerMin * periodS / 60.0f)
+  {
+    dropoutFrames = 1 + (uint32_t)(uniform() * TRACE_DROPOUT_MAX_MS * config.rateHz / 1000.0f);
+    int which = (int)(uniform() * (FLEX_COUNT + 1));
+    flexDropout = which < FLEX_COUNT ? which : -1;
+    imuDropout = which == FLEX_COUNT;
+  }
+
+  // Angle to resistance to divider voltage to ADC counts, the inverse of flexAngle()
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    double resistance = config.flatResistance[i] +
+                        pose.flex[i] / 90.0 * (config.bendResistance[i] - config.flatResistance[i]);
+    double counts = ADC_MAX * config.rDiv / (config.rDiv + resistance);
+    counts += adcOffset[i] + gaussian() * config.adcNoise;
+    int raw = (int)lround(counts);
+    raw = raw < 0 ? 0 : (raw > (int)ADC_MAX ? (int)ADC_MAX : raw);
+    sample->raw[i] = (dropoutFrames > 0 && flexDropout == i) ? 0 : raw;
+    sample->angle[i] = pose.flex[i];
+  }
+
+  if (dropoutFrames > 0 && imuDropout)
+  {
+    memcpy(sample->gyro, lastGyro, sizeof(lastGyro)); // The driver hands back its last reading
+    memcpy(sample->accel, lastAccel, sizeof(lastAccel));
+  }
+  else
+  {
+    float rates[3] = {(pose.roll - last.roll) / periodS, (pose.pitch - last.pitch) / periodS,
+                      (pose.yaw - last.yaw) / periodS};
+    float gravity[3] = {-GRAVITY * sinf(pose.pitch), GRAVITY * sinf(pose.roll) * cosf(pose.pitch),
+                        GRAVITY * cosf(pose.roll) * cosf(pose.pitch)};
+    for (int i = 0; i < 3; i++)
+    {
+      sample->gyro[i] = rates[i] + gyroBias[i] + gaussian() * config.gyroNoise;
+      sample->accel[i] = gravity[i] + gaussian() * config.accelNoise;
+    }
+    memcpy(lastGyro, sample->gyro, sizeof(lastGyro));
+    memcpy(lastAccel, sample->accel, sizeof(lastAccel));
+  }
+  if (dropoutFrames > 0)
+  {
+    dropoutFrames--;
+  }
+
+  last = pose;
+  letterFrame++;
+  frame++;
+}
+
+void traceImuToFrame(const SensorSample &sample, int16_t *frame)
+{
+  for (int imu = 0; imu < IMU_COUNT; imu++)
+  {
+    imuToFrame(sample.gyro, sample.accel, frame, imu);
+  }
+}
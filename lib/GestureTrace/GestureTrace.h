@@ -0,0 +1,108 @@
+#ifndef GESTURE_TRACE_H
+#define GESTURE_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "GlovePipeline.h"
+
+// Synthetic fingerspelling for the host tools: raw sensor readings as the
+// glove would see them while someone spells a text.
+//
+// Every letter has a hand shape (the five flex angles) and an orientation.
+// A glove with more flex channels (GLOVE_FLEX_COUNT) keeps the others straight,
+// and every IMU of the frame follows the same wrist motion.
+// The hand moves between letters along a smooth transition and holds each
+// shape for a while; J and Z add their motion during the hold. Orientation
+// becomes gravity on the accelerometer and its rate of change becomes the gyro.
+// Angles go back through the voltage divider into ADC counts, so the readings
+// run through flexAngle() and imuToFrame() exactly like the real sensors.
+//
+// On top of that: per occurrence variation of each shape and hold time,
+// ADC and IMU noise, a slow random walk on the ADC offsets and gyro bias,
+// and dropouts (a flex sensor reading 0, the IMU repeating its last reading).
+//
+// Everything comes from one seeded generator, so a seed and a config always
+// give the same trace (on hosts whose libm agrees on sinf and logf).
+
+struct TraceConfig
+{
+  uint32_t seed;
+  const char *text;      // Letters A-Z, anything else is the resting hand; repeats when spelled out
+  float rateHz;          // Frame rate
+  float holdMs;          // Mean time a letter is held, varies by +-25%
+  float transitionMs;    // Time to move from one shape to the next
+  float shapeJitterDeg;  // Per occurrence variation of each flex angle
+  float adcNoise;        // ADC noise, counts (sd)
+  float gyroNoise;       // rad/s (sd)
+  float accelNoise;      // m/s^2 (sd)
+  float adcDrift;        // Random walk of the ADC offsets, counts per sqrt(s)
+  float gyroDrift;       // Random walk of the gyro bias, rad/s per sqrt(s)
+  float dropoutsPerMin;  // Dropouts per minute, each lasting up to TRACE_DROPOUT_MAX_MS
+  double vcc;            // Divider the readings are generated for, see GloveCalibration.h
+  double rDiv;
+  const float *flatResistance;
+  const float *bendResistance;
+};
+
+#define TRACE_DROPOUT_MAX_MS 200
+
+// Typical values for a clean trace at 100 Hz with realistic noise, calibration left to the caller
+TraceConfig traceDefaults(uint32_t seed, const char *text);
+
+struct SensorSample
+{
+  uint32_t timeUs;          // Capture time, from 0 at the first sample
+  int raw[FLEX_COUNT];      // ADC counts
+  float angle[FLEX_COUNT];  // The bend the counts were generated from, degrees
+  float gyro[3];            // rad/s
+  float accel[3];           // m/s^2
+  char letter;              // The letter being held or moved to, ' ' for the resting hand
+  bool holding;             // False while moving between shapes
+};
+
+// The sample's motion into the frame slots of every IMU, the hand moves as one
+void traceImuToFrame(const SensorSample &sample, int16_t *frame);
+
+class GestureTrace
+{
+public:
+  void begin(const TraceConfig &config);
+  void next(SensorSample *sample);
+
+  unsigned long lettersSpelled() const { return spelled; }
+
+private:
+  struct Pose
+  {
+    float flex[FLEX_COUNT]; // Degrees
+    float roll, pitch, yaw; // Radians
+  };
+
+  uint32_t random();
+  float uniform();  // [0, 1)
+  float gaussian(); // Standard normal
+  void startLetter();
+  Pose current() const;
+
+  TraceConfig config;
+  uint64_t state;
+  uint32_t frame;
+  float periodS;
+
+  size_t textIndex;
+  unsigned long spelled;
+  char letter;
+  Pose from, to;
+  uint32_t letterFrame; // Frames since the letter started
+  uint32_t transitionFrames, holdFrames;
+  Pose last;
+
+  float adcOffset[FLEX_COUNT];
+  float gyroBias[3];
+  int flexDropout;       // Sensor currently reading 0, -1 for none
+  uint32_t dropoutFrames; // Frames left of the current dropout, flex or IMU
+  bool imuDropout;
+  float lastGyro[3], lastAccel[3];
+};
+
+#endif
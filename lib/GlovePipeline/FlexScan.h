@@ -0,0 +1,168 @@
+#ifndef FLEX_SCAN_H
+#define FLEX_SCAN_H
+
+#include <stdint.h>
+#include "GloveProfile.h"
+
+// Reads every flex channel of a glove variant once, in an order that keeps
+// the ADC converting instead of waiting for multiplexers to settle.
+//
+// A multiplexer input needs Profile::muxSettleUs after switching before a
+// reading is good. With more than one multiplexer the channels are taken
+// from each in turn, and the next one is switched before the current one is
+// converted, so it settles while the ADC is busy. A multiplexer is only
+// switched after its own reading, and the wait for settling is what is left
+// after the conversion. With a single multiplexer every switch has to be
+// waited out, one per channel. The last step switches to the first channel
+// of the next scan, which settles while the IMU is read.
+//
+// The hardware is behind Io, with:
+//
+//   void select(int mux, int input)   drive the select lines
+//   int convert(int channel)          ADC reading of the channel's pin
+//   uint32_t nowUs()                  a microsecond clock
+//   void waitUntilUs(uint32_t time)
+//
+// Nothing here depends on Arduino, tools/scansim runs it against a model of
+// the ADC's timing.
+
+struct ScanStep
+{
+  uint8_t channel;
+  int8_t mux; // -1 for a sensor with its own ADC pin
+  uint8_t input;
+};
+
+template <typename Profile>
+struct ScanPlan
+{
+  ScanStep step[Profile::flexCount];
+
+  // Round robin over the multiplexers, each one's channels in channel order
+  constexpr ScanPlan() : step()
+  {
+    if (Profile::muxCount == 0)
+    {
+      for (int channel = 0; channel < Profile::flexCount; channel++)
+      {
+        step[channel] = {(uint8_t)channel, -1, 0};
+      }
+      return;
+    }
+    int taken = 0;
+    for (int round = 0; round < Profile::flexCount; round++)
+    {
+      for (int mux = 0; mux < Profile::muxCount; mux++)
+      {
+        int seen = 0;
+        for (int channel = 0; channel < Profile::flexCount; channel++)
+        {
+          if (Profile::channelMux(channel) == mux && seen++ == round)
+          {
+            step[taken++] = {(uint8_t)channel, (int8_t)mux, (uint8_t)Profile::channelInput(channel)};
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // Every channel on a multiplexer that exists, no two on the same input
+  static constexpr bool wiringValid()
+  {
+    for (int channel = 0; channel < Profile::flexCount; channel++)
+    {
+      if (Profile::channelMux(channel) >= Profile::muxCount)
+      {
+        return false;
+      }
+      for (int other = 0; other < channel && Profile::muxCount > 0; other++)
+      {
+        if (Profile::channelMux(other) == Profile::channelMux(channel) &&
+            Profile::channelInput(other) == Profile::channelInput(channel))
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+  static_assert(wiringValid(), "flexMuxInputs: a channel on a missing multiplexer, or two on one input");
+};
+
+template <typename Profile, typename Io>
+class FlexScanner
+{
+public:
+  explicit FlexScanner(Io &io) : io(io), readyUs() {}
+
+  // Point every multiplexer at its first channel of a scan
+  void begin()
+  {
+    for (int mux = 0; mux < Profile::muxCount; mux++)
+    {
+      for (const ScanStep &step : plan.step)
+      {
+        if (step.mux == mux)
+        {
+          select(step);
+          break;
+        }
+      }
+    }
+  }
+
+  // raw[channel] for every channel
+  void scan(int *raw)
+  {
+    for (int k = 0; k < Profile::flexCount; k++)
+    {
+      const ScanStep &step = plan.step[k];
+      const ScanStep &next = plan.step[k + 1 < Profile::flexCount ? k + 1 : 0];
+      if (step.mux >= 0)
+      {
+        io.waitUntilUs(readyUs[step.mux]);
+      }
+      if (next.mux >= 0 && next.mux != step.mux)
+      {
+        select(next); // Settles during this conversion
+      }
+      raw[step.channel] = io.convert(step.channel);
+      if (next.mux >= 0 && next.mux == step.mux && Profile::flexCount > 1)
+      {
+        select(next);
+      }
+    }
+  }
+
+  // Switch to one channel and wait until it settled, for reading it on its own.
+  // begin() again before the next scan().
+  void hold(int channel)
+  {
+    for (const ScanStep &step : plan.step)
+    {
+      if (step.channel == channel && step.mux >= 0)
+      {
+        select(step);
+        io.waitUntilUs(readyUs[step.mux]);
+      }
+    }
+  }
+
+  static constexpr ScanPlan<Profile> plan{};
+
+private:
+  void select(const ScanStep &step)
+  {
+    if constexpr (Profile::muxCount > 0)
+    {
+      io.select(step.mux, step.input);
+      readyUs[step.mux] = io.nowUs() + Profile::muxSettleUs + 1; // + 1, the clock truncates
+    }
+  }
+
+  Io &io;
+  uint32_t readyUs[Profile::muxCount > 0 ? Profile::muxCount : 1]; // When each mux's input has settled
+};
+
+#endif
@@ -0,0 +1,12 @@
+#include "GlovePipeline.h"
+
+void imuToFrame(const float gyro[3], const float accel[3], int16_t *frame, int imu)
+{
+  int16_t *slot = frame + FRAME_IMU(imu);
+  slot[0] = (int16_t)(gyro[0] * IMU_SCALE);
+  slot[1] = (int16_t)(gyro[1] * IMU_SCALE);
+  slot[2] = (int16_t)(gyro[2] * IMU_SCALE);
+  slot[3] = (int16_t)(-accel[0] * IMU_SCALE);
+  slot[4] = (int16_t)(accel[1] * IMU_SCALE);
+  slot[5] = (int16_t)(accel[2] * IMU_SCALE);
+}
@@ -0,0 +1,62 @@
+#ifndef GLOVE_PIPELINE_H
+#define GLOVE_PIPELINE_H
+
+#include <stdint.h>
+
+// Signal processing shared by the firmware and the host tools.
+// Nothing in here touches hardware, inputs are raw readings.
+
+// Channel counts of the frame, set per glove variant in platformio.ini so the
+// frame, wire and record formats of a build all agree. Flex angles come first,
+// then IMU_VALUES per IMU.
+#ifndef GLOVE_FLEX_COUNT
+#define GLOVE_FLEX_COUNT 5
+#endif
+#ifndef GLOVE_IMU_COUNT
+#define GLOVE_IMU_COUNT 1
+#endif
+
+#define FLEX_COUNT GLOVE_FLEX_COUNT
+#define IMU_COUNT GLOVE_IMU_COUNT
+#define IMU_VALUES 6 // Gyro x/y/z, accel x/y/z
+#define FRAME_VALUES (FLEX_COUNT + IMU_VALUES * IMU_COUNT) // 11 on the five finger, one IMU glove
+#define FRAME_IMU(imu) (FLEX_COUNT + IMU_VALUES * (imu))   // First frame slot of an IMU
+#define ADC_MAX 4095.0 // 12-bit ADC
+#define IMU_SCALE 100   // Gyro and accel are sent as value * 100
+
+// Arduino's map() on longs, widened so a near-open sensor can't overflow
+constexpr int64_t mapLong(int64_t x, int64_t inMin, int64_t inMax, int64_t outMin, int64_t outMax)
+{
+  return inMax == inMin ? -1 // What map() returns for an empty input range
+                        : (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Bend angle in whole degrees from a raw ADC reading of a flex sensor in a
+// voltage divider, mapped linearly from flatResistance (0) to bendResistance (90).
+// Matches the long integer map() the firmware always used: the result is
+// truncated, never below 0 and not capped at 90.
+// constexpr so GloveProfile.h can tabulate it at compile time.
+constexpr int16_t flexAngle(int raw, double vcc, double rDiv, float flatResistance, float bendResistance)
+{
+  if (raw <= 0)
+  {
+    return INT16_MAX; // No voltage across the sensor, resistance is unbounded
+  }
+  // Double intermediates stored as float, as the original processSensorData did
+  float vFlex = raw * vcc / ADC_MAX;
+  float rFlex = rDiv * (vcc / vFlex - 1.0);
+
+  int64_t angle = mapLong((int64_t)rFlex, (int64_t)flatResistance, (int64_t)bendResistance, 0, 90);
+  if (angle < 0)
+  {
+    angle = 0;
+  }
+  return angle > INT16_MAX ? INT16_MAX : (int16_t)angle;
+}
+
+// Gyro (rad/s) and acceleration (m/s^2) of one IMU into its frame slots from
+// FRAME_IMU(imu), scaled by IMU_SCALE.
+// Accel x is negated to match the sensor's mounting on the glove.
+void imuToFrame(const float gyro[3], const float accel[3], int16_t *frame, int imu = 0);
+
+#endif
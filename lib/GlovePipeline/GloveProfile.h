@@ -0,0 +1,123 @@
+#ifndef GLOVE_PROFILE_H
+#define GLOVE_PROFILE_H
+
+#include <stdint.h>
+#include "GlovePipeline.h"
+
+// A glove variant's pipeline, specialized at compile time.
+//
+// `Hardware` describes the board and sensors with static constexpr members
+// (see GloveProfiles.h for the variants):
+//
+//   flexCount                     flex channels, the five fingers first
+//   muxCount                      analog multiplexers the channels are behind, 0 for none
+//   flexPins[flexCount]           ADC pin of each channel, without multiplexers
+//   muxAdcPins[muxCount]          with multiplexers: each one's common pin,
+//   muxSelectPins[muxCount][MUX_SELECT_BITS]  its S0..S3 pins,
+//   flexMuxInputs[flexCount]      mux * MUX_INPUTS + input of each channel
+//   muxSettleUs                   and the time an input needs to settle after switching
+//   vcc, rDiv                     divider supply and fixed resistor
+//   flatResistance[flexCount]     sensor resistance at 0 and 90 degrees
+//   bendResistance[flexCount]
+//   imuCount, imuAddresses[imuCount]
+//   imuAccelRangeG, imuGyroRangeDps, imuFilterHz   the same for every IMU
+//
+// GloveProfile<Hardware> runs flexAngle() for every finger and every ADC
+// reading at compile time, so converting a reading is one table load with
+// the divider constants folded in, and the loop over the fingers has a
+// constant trip count the compiler unrolls. Results are the same as
+// flexAngle() with the same constants.
+
+#define ADC_LEVELS 4096 // 12-bit ADC readings 0..4095
+#define MUX_INPUTS 16     // CD74HC4067: 16 inputs,
+#define MUX_SELECT_BITS 4 // picked with 4 select lines
+
+template <typename Hardware>
+struct GloveProfile : Hardware
+{
+  static_assert(Hardware::flexCount > 0 && Hardware::imuCount > 0, "a glove has flex sensors and an IMU");
+  static_assert(Hardware::muxCount >= 0, "muxCount is 0 when every sensor has its own ADC pin");
+  static_assert(Hardware::vcc > 0 && Hardware::rDiv > 0, "divider constants must be positive");
+
+  static constexpr int frameValues = Hardware::flexCount + IMU_VALUES * Hardware::imuCount;
+
+  // Multiplexer a channel is behind, -1 when it has its own ADC pin
+  static constexpr int channelMux(int channel)
+  {
+    if constexpr (Hardware::muxCount > 0)
+    {
+      return Hardware::flexMuxInputs[channel] / MUX_INPUTS;
+    }
+    return -1;
+  }
+
+  // The channel's input on its multiplexer
+  static constexpr int channelInput(int channel)
+  {
+    if constexpr (Hardware::muxCount > 0)
+    {
+      return Hardware::flexMuxInputs[channel] % MUX_INPUTS;
+    }
+    return 0;
+  }
+
+  // ADC pin the channel is converted on
+  static constexpr uint8_t channelPin(int channel)
+  {
+    if constexpr (Hardware::muxCount > 0)
+    {
+      return Hardware::muxAdcPins[channelMux(channel)];
+    }
+    else
+    {
+      return Hardware::flexPins[channel];
+    }
+  }
+
+  static constexpr uint8_t selectPin(int mux, int bit)
+  {
+    if constexpr (Hardware::muxCount > 0)
+    {
+      return Hardware::muxSelectPins[mux][bit];
+    }
+    return 0;
+  }
+
+  struct AngleTable
+  {
+    int16_t angle[Hardware::flexCount][ADC_LEVELS];
+
+    constexpr AngleTable() : angle()
+    {
+      for (int finger = 0; finger < Hardware::flexCount; finger++)
+      {
+        for (int raw = 0; raw < ADC_LEVELS; raw++)
+        {
+          angle[finger][raw] = flexAngle(raw, Hardware::vcc, Hardware::rDiv, Hardware::flatResistance[finger],
+                                         Hardware::bendResistance[finger]);
+        }
+      }
+    }
+  };
+
+  static constexpr AngleTable angleTable{};
+
+  // flexAngle() for one finger, from the table for any reading the ADC can give
+  static int16_t angle(int finger, int raw)
+  {
+    return (unsigned)raw < ADC_LEVELS ? angleTable.angle[finger][raw]
+                                      : flexAngle(raw, Hardware::vcc, Hardware::rDiv,
+                                                  Hardware::flatResistance[finger], Hardware::bendResistance[finger]);
+  }
+
+  // All fingers into frame slots 0..flexCount-1
+  static void flexAngles(const int *raw, int16_t *frame)
+  {
+    for (int finger = 0; finger < Hardware::flexCount; finger++)
+    {
+      frame[finger] = angle(finger, raw[finger]);
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef BROADCAST_FORMAT_H
+#define BROADCAST_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Letters broadcast in the manufacturer specific data of legacy advertising,
+// so any number of receivers can follow the glove without connecting.
+//
+//   company  u16 LE BROADCAST_COMPANY_ID
+//   magic    u8     BROADCAST_MAGIC
+//   version  u8     BROADCAST_VERSION
+//   sequence u8     incremented whenever the text changes
+//   text            UTF-8, the tail of the latest letters, up to BROADCAST_MAX_TEXT bytes
+//
+// 31 advertising bytes minus the flags (3) and the AD header (2) leave 26 for the data.
+
+#define BROADCAST_COMPANY_ID 0xFFFF // Reserved for testing by the Bluetooth SIG
+#define BROADCAST_MAGIC 0x47        // 'G'
+#define BROADCAST_VERSION 1
+#define BROADCAST_HEADER_SIZE 5
+#define BROADCAST_MAX_DATA 26
+#define BROADCAST_MAX_TEXT (BROADCAST_MAX_DATA - BROADCAST_HEADER_SIZE)
+#define AD_TYPE_MANUFACTURER 0xFF
+
+// Keep the end of the text, starting on a UTF-8 character boundary. Returns the data length.
+inline size_t encodeBroadcast(uint8_t sequence, const char *text, size_t length, uint8_t *out)
+{
+  const char *start = text;
+  if (length > BROADCAST_MAX_TEXT)
+  {
+    start = text + length - BROADCAST_MAX_TEXT;
+    while (start < text + length && ((uint8_t)*start & 0xC0) == 0x80)
+    {
+      start++; // Skip the continuation bytes of a character cut in half
+    }
+  }
+  size_t kept = text + length - start;
+  out[0] = (uint8_t)BROADCAST_COMPANY_ID;
+  out[1] = (uint8_t)(BROADCAST_COMPANY_ID >> 8);
+  out[2] = BROADCAST_MAGIC;
+  out[3] = BROADCAST_VERSION;
+  out[4] = sequence;
+  memcpy(out + BROADCAST_HEADER_SIZE, start, kept);
+  return BROADCAST_HEADER_SIZE + kept;
+}
+
+// Manufacturer data of one advertising report, text points into `data`
+inline bool decodeBroadcast(const uint8_t *data, size_t length, uint8_t *sequence, const char **text,
+                            size_t *textLength)
+{
+  if (length < BROADCAST_HEADER_SIZE || length > BROADCAST_MAX_DATA)
+  {
+    return false;
+  }
+  if ((data[0] | (data[1] << 8)) != BROADCAST_COMPANY_ID || data[2] != BROADCAST_MAGIC ||
+      data[3] != BROADCAST_VERSION)
+  {
+    return false;
+  }
+  *sequence = data[4];
+  *text = (const char *)data + BROADCAST_HEADER_SIZE;
+  *textLength = length - BROADCAST_HEADER_SIZE;
+  return true;
+}
+
+#endif
@@ -0,0 +1,131 @@
+#include "Commands.h"
+#include <string.h>
+
+// Fixed argument size per opcode, -1 for the variable length text
+static int argumentSize(uint8_t opcode)
+{
+  switch (opcode)
+  {
+  case CMD_SET_RATE:
+    return 2;
+  case CMD_SET_MODE:
+  case CMD_SET_PROFILE:
+  case CMD_SET_BROADCAST:
+  case CMD_SUBSCRIBE:
+  case CMD_RECORD:
+    return 1;
+  case CMD_CALIBRATE:
+  case CMD_QUERY_STATS:
+    return 0;
+  case CMD_DISPLAY_TEXT:
+    return -1;
+  }
+  return -2;
+}
+
+CommandStatus parseCommand(const uint8_t *payload, size_t length, Command *command)
+{
+  if (length == 0)
+  {
+    return COMMAND_EMPTY;
+  }
+  uint8_t opcode = payload[0];
+  const uint8_t *args = payload + 1;
+  size_t argsLength = length - 1;
+
+  int expected = argumentSize(opcode);
+  if (expected == -2)
+  {
+    return COMMAND_UNKNOWN;
+  }
+  if (expected >= 0 && argsLength != (size_t)expected)
+  {
+    return COMMAND_BAD_ARGS;
+  }
+
+  command->opcode = opcode;
+  command->value = 0;
+  command->text = NULL;
+  command->length = 0;
+  switch (opcode)
+  {
+  case CMD_SET_RATE:
+    command->value = args[0] | (args[1] << 8);
+    if (command->value < COMMAND_RATE_MIN || command->value > COMMAND_RATE_MAX)
+    {
+      return COMMAND_BAD_ARGS;
+    }
+    break;
+  case CMD_SET_MODE:
+    command->value = args[0];
+    if (command->value >= COMMAND_MODE_COUNT)
+    {
+      return COMMAND_BAD_ARGS;
+    }
+    break;
+  case CMD_SET_PROFILE:
+    command->value = args[0];
+    if (command->value >= COMMAND_PROFILE_COUNT)
+    {
+      return COMMAND_BAD_ARGS;
+    }
+    break;
+  case CMD_SET_BROADCAST:
+  case CMD_RECORD:
+    command->value = args[0];
+    if (command->value > 1)
+    {
+      return COMMAND_BAD_ARGS;
+    }
+    break;
+  case CMD_SUBSCRIBE:
+    command->value = args[0];
+    if (command->value & ~COMMAND_STREAM_MASK)
+    {
+      return COMMAND_BAD_ARGS;
+    }
+    break;
+  case CMD_DISPLAY_TEXT:
+    if (argsLength > UINT16_MAX)
+    {
+      return COMMAND_BAD_ARGS; // Longer than Command::length holds
+    }
+    command->text = (const char *)args;
+    command->length = (uint16_t)argsLength;
+    break;
+  }
+  return COMMAND_OK;
+}
+
+size_t encodeCommand(const Command &command, uint8_t *out, size_t capacity)
+{
+  int size = argumentSize(command.opcode);
+  if (size == -2)
+  {
+    return 0;
+  }
+  size_t total = 1 + (size == -1 ? command.length : (size_t)size);
+  if (total > capacity)
+  {
+    return 0;
+  }
+  out[0] = command.opcode;
+  switch (command.opcode)
+  {
+  case CMD_SET_RATE:
+    out[1] = (uint8_t)command.value;
+    out[2] = (uint8_t)(command.value >> 8);
+    break;
+  case CMD_SET_MODE:
+  case CMD_SET_PROFILE:
+  case CMD_SET_BROADCAST:
+  case CMD_SUBSCRIBE:
+  case CMD_RECORD:
+    out[1] = (uint8_t)command.value;
+    break;
+  case CMD_DISPLAY_TEXT:
+    memcpy(out + 1, command.text, command.length);
+    break;
+  }
+  return total;
+}
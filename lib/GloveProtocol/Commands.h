@@ -0,0 +1,68 @@
+#ifndef COMMANDS_H
+#define COMMANDS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Payload of a MSG_COMMAND message: one opcode byte followed by its arguments, little endian.
+//
+//   SET_RATE      u16 frame interval in ms for this central (COMMAND_RATE_MIN..COMMAND_RATE_MAX)
+//   SET_MODE      u8  display view, 0 text, 1 telemetry, 2 history
+//   CALIBRATE     no arguments
+//   DISPLAY_TEXT  UTF-8 text, the rest of the payload
+//   QUERY_STATS   no arguments, answered with MSG_STATS, MSG_LINK and MSG_CONNECTION notifications to the sender
+//   SET_PROFILE   u8  connection profile, 0 low latency, 1 balanced, 2 low power
+//   SET_BROADCAST u8  0 off, 1 letters in the advertising data (see BroadcastFormat.h)
+//   SUBSCRIBE     u8  streams this central receives, bit 0 frames, bit 1 letters, bit 2 stats,
+//                     bit 3 frames bit-packed (PackedFrame.h), bit 4 frames compressed (FrameCodec.h)
+//   RECORD        u8  0 stop, 1 start recording frames to flash
+//
+// Parsing never copies or allocates, text arguments point into the payload.
+
+#define COMMAND_RATE_MIN 10
+#define COMMAND_RATE_MAX 1000
+#define COMMAND_MODE_COUNT 3
+#define COMMAND_PROFILE_COUNT 3
+#define COMMAND_STREAM_MASK 0x1F
+
+// X(name, opcode). Opcodes are part of the wire format, never renumber them.
+#define GLOVE_COMMANDS(X) \
+  X(SET_RATE, 0x01)       \
+  X(SET_MODE, 0x02)       \
+  X(CALIBRATE, 0x03)      \
+  X(DISPLAY_TEXT, 0x04)   \
+  X(QUERY_STATS, 0x05)    \
+  X(SET_PROFILE, 0x06)    \
+  X(SET_BROADCAST, 0x07)  \
+  X(SUBSCRIBE, 0x08)      \
+  X(RECORD, 0x09)
+
+enum CommandOpcode : uint8_t
+{
+#define COMMAND_ENUM(name, opcode) CMD_##name = opcode,
+  GLOVE_COMMANDS(COMMAND_ENUM)
+#undef COMMAND_ENUM
+};
+
+enum CommandStatus
+{
+  COMMAND_OK,
+  COMMAND_EMPTY,    // No opcode
+  COMMAND_UNKNOWN,  // Opcode this firmware does not know
+  COMMAND_BAD_ARGS  // Wrong argument size or value out of range
+};
+
+struct Command
+{
+  uint8_t opcode;
+  uint16_t value;   // SET_RATE interval, SET_MODE view, SET_PROFILE profile, SET_BROADCAST on/off, SUBSCRIBE mask, RECORD on/off
+  const char *text; // DISPLAY_TEXT, points into the parsed payload
+  uint16_t length;
+};
+
+CommandStatus parseCommand(const uint8_t *payload, size_t length, Command *command);
+
+// Write a command payload for the app side, returns its size or 0 if it does not fit
+size_t encodeCommand(const Command &command, uint8_t *out, size_t capacity);
+
+#endif
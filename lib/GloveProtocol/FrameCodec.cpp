@@ -0,0 +1,412 @@
+#include "FrameCodec.h"
+
+#define COST_DECAY 3         // Predictor misses fade by 1/8 per sample
+#define COST_LIMIT 0xFFFF    // Largest miss counted, keeps the costs from overflowing
+#define RICE_LIMIT 0xFFFFF   // Largest difference counted into riceSum
+#define RICE_HALVING 16      // Samples between halvings of the Rice statistics, a short memory codes best
+#define RICE_START 16        // riceSum of a fresh model, k = 4
+
+static_assert(RICE_HALVING <= UINT8_MAX, "riceCount is a byte");
+
+static uint32_t zigzag(int32_t value)
+{
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value)
+{
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// Little endian bit stream into out[at..limit), `at` keeps counting past the limit
+struct BitWriter
+{
+  uint8_t *out;
+  size_t at;
+  size_t limit;
+  uint64_t bits;
+  int held;
+
+  // `value` has nothing above its low `count` bits, count <= 32
+  void put(uint32_t value, int count)
+  {
+    bits |= (uint64_t)value << held;
+    held += count;
+    if (held >= 32)
+    {
+      emit(4);
+    }
+  }
+
+  // Whole bytes out of `bits`, ending a stream rounds up to the last one
+  void emit(int bytes)
+  {
+    for (int i = 0; i < bytes; i++)
+    {
+      if (at < limit)
+      {
+        out[at] = (uint8_t)bits;
+      }
+      at++;
+      bits >>= 8;
+    }
+    held = held > 8 * bytes ? held - 8 * bytes : 0;
+  }
+
+  void flush()
+  {
+    emit((held + 7) / 8);
+  }
+};
+
+struct BitReader
+{
+  const uint8_t *in;
+  const uint8_t *end;
+  uint64_t bits;
+  int held;
+  int past; // Zero bytes fed in after the end
+
+  void fill()
+  {
+    while (held <= 56)
+    {
+      if (in < end)
+      {
+        bits |= (uint64_t)*in++ << held;
+      }
+      else
+      {
+        past++;
+      }
+      held += 8;
+    }
+  }
+
+  uint32_t take(int count)
+  {
+    fill();
+    uint32_t value = (uint32_t)(bits & (((uint64_t)1 << count) - 1));
+    bits >>= count;
+    held -= count;
+    return value;
+  }
+
+  // One bits before the next zero, at most CODEC_ESCAPE
+  int ones()
+  {
+    fill();
+    int n = __builtin_ctzll(~bits | (uint64_t)1 << 63); // Held bits never run out before the escape
+    n = n < CODEC_ESCAPE ? n : CODEC_ESCAPE;
+    bits >>= n + (n < CODEC_ESCAPE); // The zero ends a short run, an escape has none
+    held -= n + (n < CODEC_ESCAPE);
+    return n;
+  }
+
+  // Bytes of the stream read so far, the last one partly
+  size_t used(const uint8_t *start) const
+  {
+    size_t fed = (size_t)(in - start) + past;
+    return fed - held / 8;
+  }
+};
+
+// Per sample steps, Wide for the 32 bit capture time and narrow for the 16 bit
+// channels, so each call site compiles to one of them without branching.
+
+// A difference modulo the channel's width, as the nearest signed value
+template <bool Wide>
+static inline int32_t wrapped(uint32_t difference)
+{
+  return Wide ? (int32_t)difference : (int32_t)(int16_t)difference;
+}
+
+template <bool Wide>
+static inline uint32_t predict(const CodecModel &model, int channel)
+{
+  uint32_t last = model.last[channel];
+  uint32_t line = 2 * last - model.before[channel];
+  uint32_t prediction = model.order2Cost[channel] < model.order1Cost[channel] ? line : last;
+  return Wide ? prediction : prediction & 0xFFFF;
+}
+
+// Smallest k with count << k >= sum, so 2^k is about the average difference
+static inline int riceParameter(const CodecModel &model, int channel)
+{
+  uint32_t count = model.riceCount[channel];
+  uint32_t sum = model.riceSum[channel];
+  if (sum <= count)
+  {
+    return 0;
+  }
+  int k = __builtin_clz(count) - __builtin_clz(sum); // Leading bits line up, one short at most
+  return k + ((count << k) < sum);
+}
+
+static inline uint32_t absolute(int32_t value)
+{
+  return value < 0 ? (uint32_t)-value : (uint32_t)value;
+}
+
+static inline uint32_t limited(uint32_t value, uint32_t limit)
+{
+  return value < limit ? value : limit;
+}
+
+// Everything both ends learn from one sample, `residual` being its zigzagged difference to predict()
+template <bool Wide>
+static inline void update(CodecModel &model, int channel, uint32_t sample, uint32_t residual)
+{
+  uint32_t last = model.last[channel];
+  uint32_t order1Miss = absolute(wrapped<Wide>(sample - last));
+  uint32_t order2Miss = absolute(wrapped<Wide>(sample - (2 * last - model.before[channel])));
+  uint32_t &order1Cost = model.order1Cost[channel];
+  uint32_t &order2Cost = model.order2Cost[channel];
+  order1Cost += limited(order1Miss, COST_LIMIT) - (order1Cost >> COST_DECAY);
+  order2Cost += limited(order2Miss, COST_LIMIT) - (order2Cost >> COST_DECAY);
+  model.before[channel] = last;
+  model.last[channel] = sample;
+
+  model.riceSum[channel] += limited(residual, RICE_LIMIT);
+  if (++model.riceCount[channel] == RICE_HALVING)
+  {
+    model.riceSum[channel] >>= 1;
+    model.riceCount[channel] >>= 1;
+  }
+}
+
+template <bool Wide>
+static inline void learnSample(CodecModel &model, int channel, uint32_t sample)
+{
+  update<Wide>(model, channel, sample, zigzag(wrapped<Wide>(sample - predict<Wide>(model, channel))));
+}
+
+template <bool Wide>
+static inline void encodeSample(CodecModel &model, BitWriter &writer, int channel, uint32_t sample)
+{
+  uint32_t residual = zigzag(wrapped<Wide>(sample - predict<Wide>(model, channel)));
+  int k = riceParameter(model, channel);
+  uint32_t q = residual >> k;
+  if (q < CODEC_ESCAPE)
+  {
+    writer.put((1u << q) - 1, q + 1);
+    writer.put(residual & ((1u << k) - 1), k);
+  }
+  else
+  {
+    writer.put((1u << CODEC_ESCAPE) - 1, CODEC_ESCAPE);
+    writer.put(residual, Wide ? 32 : 16);
+  }
+  update<Wide>(model, channel, sample, residual);
+}
+
+template <bool Wide>
+static inline uint32_t decodeSample(CodecModel &model, BitReader &reader, int channel)
+{
+  int k = riceParameter(model, channel);
+  int q = reader.ones();
+  uint32_t residual = q < CODEC_ESCAPE ? ((uint32_t)q << k) | reader.take(k) : reader.take(Wide ? 32 : 16);
+  uint32_t sample = predict<Wide>(model, channel) + (uint32_t)unzigzag(residual);
+  sample = Wide ? sample : sample & 0xFFFF;
+  update<Wide>(model, channel, sample, residual);
+  return sample;
+}
+
+// Channels in order: sequence, capture time, values
+void CodecModel::prime(const CodecFrame &frame)
+{
+  last[0] = frame.sequence;
+  last[1] = frame.captureUs;
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    last[2 + i] = (uint16_t)frame.values[i];
+  }
+  for (int c = 0; c < CODEC_CHANNELS; c++)
+  {
+    before[c] = last[c];
+    order1Cost[c] = order2Cost[c] = 0; // Order 1 wins ties, until there is a line to follow
+    riceSum[c] = RICE_START;
+    riceCount[c] = 1;
+  }
+}
+
+void CodecModel::learn(const CodecFrame &frame)
+{
+  learnSample<false>(*this, 0, frame.sequence);
+  learnSample<true>(*this, 1, frame.captureUs);
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    learnSample<false>(*this, 2 + i, (uint16_t)frame.values[i]);
+  }
+}
+
+static void encodeBits(CodecModel &model, BitWriter &writer, const CodecFrame &frame)
+{
+  encodeSample<false>(model, writer, 0, frame.sequence);
+  encodeSample<true>(model, writer, 1, frame.captureUs);
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    encodeSample<false>(model, writer, 2 + i, (uint16_t)frame.values[i]);
+  }
+}
+
+static void decodeBits(CodecModel &model, BitReader &reader, CodecFrame &frame)
+{
+  frame.sequence = (uint16_t)decodeSample<false>(model, reader, 0);
+  frame.captureUs = decodeSample<true>(model, reader, 1);
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    frame.values[i] = (int16_t)decodeSample<false>(model, reader, 2 + i);
+  }
+}
+
+void FrameEncoder::reset()
+{
+  sinceKey = 0; // Block numbers carry on, so a key block the central missed is a gap as well
+}
+
+size_t FrameEncoder::encode(const CodecFrame *frames, int count, uint8_t *out, size_t capacity)
+{
+  if (count < 1 || count > CODEC_MAX_FRAMES || capacity < (size_t)CODEC_MAX_BLOCK(count))
+  {
+    return 0;
+  }
+  bool key = sinceKey == 0;
+  sinceKey = (uint8_t)((sinceKey + 1) % CODEC_KEY_INTERVAL);
+  out[1] = block++;
+  out[2] = (uint8_t)count;
+
+  uint8_t *data = out + CODEC_HEADER_SIZE;
+  size_t stored = (size_t)count * FRAME_PAYLOAD_SIZE;
+  int first = 0;
+  if (key)
+  {
+    model.prime(frames[0]);
+    encodeFrame(frames[0].values, frames[0].sequence, frames[0].captureUs, data);
+    first = 1;
+  }
+
+  BitWriter writer = {data, key ? (size_t)FRAME_PAYLOAD_SIZE : 0, stored, 0, 0};
+  int f = first;
+  for (; f < count && writer.at < stored; f++)
+  {
+    encodeBits(model, writer, frames[f]);
+  }
+  writer.flush();
+
+  if (writer.at < stored)
+  {
+    out[0] = key ? CODEC_KEY : 0;
+    return CODEC_HEADER_SIZE + writer.at;
+  }
+
+  // Coding didn't pay, the frames go as they are and the model catches up on the rest
+  for (; f < count; f++)
+  {
+    model.learn(frames[f]);
+  }
+  out[0] = (uint8_t)(CODEC_STORED | (key ? CODEC_KEY : 0));
+  for (int i = 0; i < count; i++)
+  {
+    encodeFrame(frames[i].values, frames[i].sequence, frames[i].captureUs, data + i * FRAME_PAYLOAD_SIZE);
+  }
+  return CODEC_HEADER_SIZE + stored;
+}
+
+void FrameDecoder::reset()
+{
+  expected = 0;
+  synced = false;
+}
+
+static void readFrame(const uint8_t *in, CodecFrame *frame)
+{
+  decodeFrame(in, FRAME_PAYLOAD_SIZE, frame->values, &frame->sequence, &frame->captureUs);
+}
+
+CodecStatus FrameDecoder::decode(const uint8_t *in, size_t length, CodecFrame *frames, int capacity, int *count)
+{
+  if (length < CODEC_HEADER_SIZE || (in[0] & ~(CODEC_KEY | CODEC_STORED)) || in[2] == 0 || in[2] > capacity)
+  {
+    synced = false;
+    return CODEC_BAD_BLOCK;
+  }
+  bool key = in[0] & CODEC_KEY;
+  if (!key && (!synced || in[1] != expected))
+  {
+    synced = false;
+    return CODEC_NEED_KEY;
+  }
+  int n = in[2];
+  const uint8_t *data = in + CODEC_HEADER_SIZE;
+  size_t dataLength = length - CODEC_HEADER_SIZE;
+
+  if (in[0] & CODEC_STORED)
+  {
+    if (dataLength != (size_t)n * FRAME_PAYLOAD_SIZE)
+    {
+      synced = false;
+      return CODEC_BAD_BLOCK;
+    }
+    for (int f = 0; f < n; f++)
+    {
+      readFrame(data + f * FRAME_PAYLOAD_SIZE, &frames[f]);
+      if (key && f == 0)
+      {
+        model.prime(frames[f]);
+      }
+      else
+      {
+        model.learn(frames[f]);
+      }
+    }
+  }
+  else
+  {
+    int first = 0;
+    if (key)
+    {
+      if (dataLength < FRAME_PAYLOAD_SIZE)
+      {
+        synced = false;
+        return CODEC_BAD_BLOCK;
+      }
+      readFrame(data, &frames[0]);
+      model.prime(frames[0]);
+      first = 1;
+    }
+    BitReader reader = {data + first * FRAME_PAYLOAD_SIZE, data + dataLength, 0, 0, 0};
+    for (int f = first; f < n; f++)
+    {
+      decodeBits(model, reader, frames[f]);
+      if (reader.past > 8)
+      {
+        break; // Ran off the end, caught below
+      }
+    }
+    if (reader.used(data + first * FRAME_PAYLOAD_SIZE) != dataLength - first * FRAME_PAYLOAD_SIZE)
+    {
+      synced = false;
+      return CODEC_BAD_BLOCK;
+    }
+  }
+
+  expected = (uint8_t)(in[1] + 1);
+  synced = true;
+  *count = n;
+  return CODEC_OK;
+}
+
+const char *codecStatusName(CodecStatus status)
+{
+  switch (status)
+  {
+  case CODEC_OK:
+    return "ok";
+  case CODEC_NEED_KEY:
+    return "need key";
+  case CODEC_BAD_BLOCK:
+    return "bad block";
+  }
+  return "unknown";
+}
@@ -0,0 +1,113 @@
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "GlovePipeline.h"
+#include "FrameFormat.h"
+
+// Payload of a MSG_CODED_FRAMES message: one block of frames, losslessly
+// compressed. Each notification batch of a session is one block.
+//
+//   flags u8 (CODEC_KEY, CODEC_STORED), block number u8, frame count u8,
+//   then the frames
+//
+// Every frame is coded as CODEC_CHANNELS channels: the sequence number, the
+// capture time and the FRAME_VALUES values. Each channel predicts its next
+// sample from its last two, as the last one (order 1) or the line through
+// both (order 2), whichever has been closer lately. The difference to the
+// prediction, taken modulo the channel's width and zigzagged, is Rice coded
+// with a parameter that follows the channel's recent average (LOCO-I
+// style): q = r >> k as q one bits and a zero, then the k low bits. A q of
+// CODEC_ESCAPE or more is sent as CODEC_ESCAPE one bits and the whole
+// zigzagged difference instead. The bits are a little endian stream like
+// PackedFrame.h, padded with zeros to a byte.
+//
+// The model is never sent, both ends update it from the decoded samples:
+//
+//   CODEC_KEY     the model starts over, the first frame is sent as a
+//                 MSG_FRAME payload (FrameFormat.h) and becomes the history
+//   CODEC_STORED  every frame is sent as a MSG_FRAME payload, when coding
+//                 would have taken more bytes. The model learns from them
+//                 as if they had been coded.
+//
+// A block depends on every block since the last key block, so the decoder
+// drops blocks after a gap in the block numbers until the next key block.
+// The encoder sends one every CODEC_KEY_INTERVAL blocks, and whenever it is
+// reset, e.g. after a block that didn't reach the central.
+
+#define CODEC_HEADER_SIZE 3
+#define CODEC_CHANNELS (2 + FRAME_VALUES) // Sequence, capture time, values
+#define CODEC_MAX_FRAMES 255
+#define CODEC_KEY_INTERVAL 32 // Blocks
+#define CODEC_ESCAPE 24       // Unary length that switches to the raw difference
+#define CODEC_MAX_BLOCK(frames) (CODEC_HEADER_SIZE + (frames) * FRAME_PAYLOAD_SIZE) // A stored block
+
+enum CodecFlags : uint8_t
+{
+  CODEC_KEY = 0x01,
+  CODEC_STORED = 0x02
+};
+
+enum CodecStatus : uint8_t
+{
+  CODEC_OK,
+  CODEC_NEED_KEY,  // After a gap, or before the first key block
+  CODEC_BAD_BLOCK  // Truncated, trailing bytes, or more frames than fit
+};
+
+struct CodecFrame
+{
+  int16_t values[FRAME_VALUES];
+  uint16_t sequence;
+  uint32_t captureUs;
+};
+
+// Prediction and Rice statistics of every channel, identical at both ends
+struct CodecModel
+{
+  uint32_t last[CODEC_CHANNELS];
+  uint32_t before[CODEC_CHANNELS];
+  uint32_t order1Cost[CODEC_CHANNELS]; // Decaying sums of each predictor's miss
+  uint32_t order2Cost[CODEC_CHANNELS];
+  uint32_t riceSum[CODEC_CHANNELS]; // Zigzagged differences since the last halving
+  uint8_t riceCount[CODEC_CHANNELS];
+
+  void prime(const CodecFrame &frame);
+  void learn(const CodecFrame &frame);
+};
+
+class FrameEncoder
+{
+public:
+  FrameEncoder() : block(0) { reset(); }
+  void reset(); // The next block is a key block
+
+  // One block of `count` frames (1..CODEC_MAX_FRAMES), returns its size or 0 if
+  // `capacity` is below CODEC_MAX_BLOCK(count)
+  size_t encode(const CodecFrame *frames, int count, uint8_t *out, size_t capacity);
+
+private:
+  CodecModel model;
+  uint8_t block;
+  uint8_t sinceKey;
+};
+
+class FrameDecoder
+{
+public:
+  FrameDecoder() { reset(); }
+  void reset(); // Waits for a key block
+
+  // Frames of one block into `frames`, `count` of them on CODEC_OK
+  CodecStatus decode(const uint8_t *in, size_t length, CodecFrame *frames, int capacity, int *count);
+
+private:
+  CodecModel model;
+  uint8_t expected; // Block number that follows the last one decoded
+  bool synced;
+};
+
+const char *codecStatusName(CodecStatus status);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef FRAME_FORMAT_H
+#define FRAME_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "GlovePipeline.h"
+
+// Payloads of the MSG_FRAME and MSG_SYNC messages (see GloveProtocol.h), all little endian.
+//
+// Sensor frame (28 bytes on the five finger, one IMU glove): the FRAME_VALUES
+// int16 dataArray values (GlovePipeline.h), then a uint16 sequence number
+// incremented per frame and the uint32 esp_timer time in microseconds at
+// which the sensors were read. A MSG_FRAME payload holds
+// one or more frames back to back, oldest first.
+//
+// Clock sync: the app sends its own uint64 clock (t1). The glove answers
+// with t1, the time the request arrived (t2) and the time the reply was
+// sent (t3), both uint64 esp_timer microseconds. The app notes the arrival
+// time t4 and gets offset = ((t2 - t1) + (t3 - t4)) / 2 and
+// round trip = (t4 - t1) - (t3 - t2).
+
+#define FRAME_PAYLOAD_SIZE (FRAME_VALUES * 2 + 2 + 4)
+#define SYNC_REQUEST_SIZE 8
+#define SYNC_REPLY_SIZE 24
+
+inline void putLE(uint8_t *out, uint64_t value, int bytes)
+{
+  for (int i = 0; i < bytes; i++)
+  {
+    out[i] = (uint8_t)(value >> (8 * i));
+  }
+}
+
+inline uint64_t getLE(const uint8_t *in, int bytes)
+{
+  uint64_t value = 0;
+  for (int i = bytes - 1; i >= 0; i--)
+  {
+    value = (value << 8) | in[i];
+  }
+  return value;
+}
+
+inline size_t encodeFrame(const int16_t *values, uint16_t sequence, uint32_t captureUs, uint8_t *out)
+{
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    putLE(out + 2 * i, (uint16_t)values[i], 2);
+  }
+  putLE(out + FRAME_VALUES * 2, sequence, 2);
+  putLE(out + FRAME_VALUES * 2 + 2, captureUs, 4);
+  return FRAME_PAYLOAD_SIZE;
+}
+
+inline bool decodeFrame(const uint8_t *in, size_t length, int16_t *values, uint16_t *sequence, uint32_t *captureUs)
+{
+  if (length != FRAME_PAYLOAD_SIZE)
+  {
+    return false;
+  }
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    values[i] = (int16_t)getLE(in + 2 * i, 2);
+  }
+  *sequence = (uint16_t)getLE(in + FRAME_VALUES * 2, 2);
+  *captureUs = (uint32_t)getLE(in + FRAME_VALUES * 2 + 2, 4);
+  return true;
+}
+
+inline size_t encodeSyncReply(uint64_t t1, uint64_t t2, uint64_t t3, uint8_t *out)
+{
+  putLE(out, t1, 8);
+  putLE(out + 8, t2, 8);
+  putLE(out + 16, t3, 8);
+  return SYNC_REPLY_SIZE;
+}
+
+#endif
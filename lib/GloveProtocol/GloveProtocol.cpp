@@ -0,0 +1,77 @@
+#include "GloveProtocol.h"
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), one nibble at a time to keep the table at 32 bytes
+static const uint16_t crcNibbles[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+uint16_t crc16(const uint8_t *data, size_t length, uint16_t crc)
+{
+  for (size_t i = 0; i < length; i++)
+  {
+    crc = (crc << 4) ^ crcNibbles[(crc >> 12) ^ (data[i] >> 4)];
+    crc = (crc << 4) ^ crcNibbles[(crc >> 12) ^ (data[i] & 0x0F)];
+  }
+  return crc;
+}
+
+size_t sealMessage(uint8_t *buffer, size_t capacity, MessageType type, size_t payloadLength)
+{
+  size_t total = payloadLength + PROTOCOL_OVERHEAD;
+  if (payloadLength > PROTOCOL_MAX_PAYLOAD || total > capacity)
+  {
+    return 0;
+  }
+  buffer[0] = PROTOCOL_VERSION;
+  buffer[1] = type;
+  buffer[2] = (uint8_t)payloadLength;
+  buffer[3] = (uint8_t)(payloadLength >> 8);
+  uint16_t crc = crc16(buffer, PROTOCOL_HEADER_SIZE + payloadLength);
+  buffer[total - 2] = (uint8_t)crc;
+  buffer[total - 1] = (uint8_t)(crc >> 8);
+  return total;
+}
+
+ProtocolStatus parseMessage(const uint8_t *data, size_t length, Message *message)
+{
+  if (length < PROTOCOL_OVERHEAD)
+  {
+    return PROTOCOL_TRUNCATED;
+  }
+  if (data[0] != PROTOCOL_VERSION)
+  {
+    return PROTOCOL_BAD_VERSION;
+  }
+  size_t payloadLength = data[2] | (data[3] << 8);
+  if (length < payloadLength + PROTOCOL_OVERHEAD)
+  {
+    return PROTOCOL_TRUNCATED;
+  }
+  if (length > payloadLength + PROTOCOL_OVERHEAD || payloadLength > PROTOCOL_MAX_PAYLOAD)
+  {
+    return PROTOCOL_BAD_LENGTH;
+  }
+  const uint8_t *crcBytes = data + PROTOCOL_HEADER_SIZE + payloadLength;
+  if (crc16(data, PROTOCOL_HEADER_SIZE + payloadLength) != (crcBytes[0] | (crcBytes[1] << 8)))
+  {
+    return PROTOCOL_BAD_CRC;
+  }
+  message->type = data[1];
+  message->payload = data + PROTOCOL_HEADER_SIZE;
+  message->length = (uint16_t)payloadLength;
+  return PROTOCOL_OK;
+}
+
+const char *messageTypeName(uint8_t type)
+{
+  switch (type)
+  {
+#define MESSAGE_NAME(name, id, label) \
+  case id:                            \
+    return label;
+    GLOVE_MESSAGE_TYPES(MESSAGE_NAME)
+#undef MESSAGE_NAME
+  }
+  return "unknown";
+}
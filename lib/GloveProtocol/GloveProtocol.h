@@ -0,0 +1,78 @@
+#ifndef GLOVE_PROTOCOL_H
+#define GLOVE_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Framing of every message on the glove's GATT service, shared by the firmware and the host tools.
+//
+//   version  u8     PROTOCOL_VERSION
+//   type     u8     MessageType
+//   length   u16 LE payload bytes
+//   payload
+//   crc      u16 LE CRC-16/CCITT-FALSE over everything before it
+//
+// Nothing is copied: the encoder seals a payload that was written in place
+// after the header, the decoder points into the received buffer.
+
+#define PROTOCOL_VERSION 1
+#define PROTOCOL_HEADER_SIZE 4
+#define PROTOCOL_CRC_SIZE 2
+#define PROTOCOL_OVERHEAD (PROTOCOL_HEADER_SIZE + PROTOCOL_CRC_SIZE)
+#define PROTOCOL_MAX_MESSAGE 512 // Largest GATT attribute value
+#define PROTOCOL_MAX_PAYLOAD (PROTOCOL_MAX_MESSAGE - PROTOCOL_OVERHEAD)
+
+// X(name, id, label). Ids are part of the wire format, never renumber them.
+#define GLOVE_MESSAGE_TYPES(X) \
+  X(FRAME, 0x01, "frame")      \
+  X(LETTER, 0x02, "letter")    \
+  X(STATS, 0x03, "stats")      \
+  X(COMMAND, 0x04, "command")  \
+  X(SYNC, 0x05, "sync")        \
+  X(LINK, 0x06, "link")        \
+  X(CONNECTION, 0x07, "connection") \
+  X(BULK, 0x08, "bulk")        \
+  X(PACKED_FRAME, 0x09, "packed") \
+  X(CODED_FRAMES, 0x0A, "coded")
+
+enum MessageType : uint8_t
+{
+#define MESSAGE_ENUM(name, id, label) MSG_##name = id,
+  GLOVE_MESSAGE_TYPES(MESSAGE_ENUM)
+#undef MESSAGE_ENUM
+};
+
+enum ProtocolStatus
+{
+  PROTOCOL_OK,
+  PROTOCOL_TRUNCATED,   // Shorter than the header, or than the length it declares
+  PROTOCOL_BAD_VERSION, // Sent by a newer or older protocol version
+  PROTOCOL_BAD_LENGTH,  // Bytes left over after the CRC, or a payload over PROTOCOL_MAX_PAYLOAD
+  PROTOCOL_BAD_CRC
+};
+
+struct Message
+{
+  uint8_t type;
+  const uint8_t *payload; // Points into the buffer that was parsed
+  uint16_t length;
+};
+
+uint16_t crc16(const uint8_t *data, size_t length, uint16_t crc = 0xFFFF);
+
+// Where to write the payload of a message that starts at `buffer`
+inline uint8_t *messagePayload(uint8_t *buffer)
+{
+  return buffer + PROTOCOL_HEADER_SIZE;
+}
+
+// Fill in the header and CRC around a payload already written at messagePayload(buffer).
+// Returns the message size, or 0 if it does not fit in `capacity`.
+size_t sealMessage(uint8_t *buffer, size_t capacity, MessageType type, size_t payloadLength);
+
+// Check a received message, on success `message` points at its payload inside `data`
+ProtocolStatus parseMessage(const uint8_t *data, size_t length, Message *message);
+
+const char *messageTypeName(uint8_t type); // "unknown" for ids this version does not know
+
+#endif
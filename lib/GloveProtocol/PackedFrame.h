@@ -0,0 +1,203 @@
+#ifndef PACKED_FRAME_H
+#define PACKED_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "GlovePipeline.h"
+
+// Payload of a MSG_PACKED_FRAME message: the frame of FrameFormat.h with
+// every field cut to the bits it needs, 16 bytes instead of 28 on the five
+// finger, one IMU glove. Frames are byte aligned and back to back, oldest
+// first, like MSG_FRAME. Within a frame, fields are a little endian bit
+// stream, the first field in the lowest bits of the first byte.
+//
+// X(name, scope, count, bits, step, kind)
+//   scope  PACKED_ONCE per frame, or PACKED_PER_IMU for every IMU in turn
+//   count  fields in a row, `bits` bits each
+//   step   frame units per packed unit, a power of two, the value is packed * step
+//   kind   PACKED_UNSIGNED and PACKED_SIGNED round to the nearest step (ties up) and
+//          saturate at the field's range. PACKED_WRAP keeps the low bits of
+//          a counter, packedUnwrap() restores it against a nearby value.
+//
+// The fields are the sequence number and capture time first, then the
+// frame's values in frame order, so the schema has to list them that way.
+// Change the widths and steps here, pack and unpack follow.
+//
+//   sequence  the frame's uint16 sequence number, mod 256
+//   capture   esp_timer microseconds in 8 us steps, wraps every 4.2 s
+//   flex      degrees, 127 means 127 or more (a disconnected sensor)
+//   gyro      0.01 rad/s as in the frame, +-10.2 rad/s covers the 500 dps range
+//   accel     0.08 m/s^2 (8 mg, about the sensor's noise), +-81.9 covers 8 g
+
+#define PACKED_FRAME_SCHEMA(X)                                \
+  X(sequence, PACKED_ONCE, 1, 8, 1, PACKED_WRAP)              \
+  X(capture, PACKED_ONCE, 1, 19, 8, PACKED_WRAP)              \
+  X(flex, PACKED_ONCE, FLEX_COUNT, 7, 1, PACKED_UNSIGNED)     \
+  X(gyro, PACKED_PER_IMU, 3, 11, 1, PACKED_SIGNED)            \
+  X(accel, PACKED_PER_IMU, 3, 11, 8, PACKED_SIGNED)
+
+enum PackedScope : uint8_t
+{
+  PACKED_ONCE,
+  PACKED_PER_IMU
+};
+
+enum PackedKind : uint8_t
+{
+  PACKED_WRAP,
+  PACKED_UNSIGNED,
+  PACKED_SIGNED
+};
+
+#define PACKED_FIELD_BITS(name, scope, count, bits, step, kind) +((scope) == PACKED_PER_IMU ? IMU_COUNT : 1) * (count) * (bits)
+#define PACKED_FIELD_COUNT(name, scope, count, bits, step, kind) +((scope) == PACKED_PER_IMU ? IMU_COUNT : 1) * (count)
+
+#define PACKED_FRAME_BITS (0 PACKED_FRAME_SCHEMA(PACKED_FIELD_BITS))
+#define PACKED_FRAME_SIZE ((PACKED_FRAME_BITS + 7) / 8)
+#define PACKED_FIELDS (2 + FRAME_VALUES) // Sequence, capture, values
+
+static_assert(0 PACKED_FRAME_SCHEMA(PACKED_FIELD_COUNT) == PACKED_FIELDS,
+              "the schema has a field for the sequence, the capture time and every frame value");
+
+struct PackedField
+{
+  uint8_t bits;
+  uint8_t kind;
+  uint8_t shift; // log2(step)
+};
+
+constexpr uint8_t packedShift(int step)
+{
+  return step > 1 ? 1 + packedShift(step / 2) : 0;
+}
+
+#define PACKED_STEP_VALID(name, scope, count, bits, step, kind) &&(1 << packedShift(step)) == (step)
+static_assert(true PACKED_FRAME_SCHEMA(PACKED_STEP_VALID), "every step is a power of two");
+
+// The schema flattened to one entry per field, in stream order
+struct PackedLayout
+{
+  PackedField field[PACKED_FIELDS];
+
+  constexpr PackedLayout() : field()
+  {
+    int n = 0;
+#define PACKED_ADD_ONCE(name, scope, count, bits, step, kind) \
+  for (int i = 0; i < (count) && (scope) == PACKED_ONCE; i++)   \
+  {                                                             \
+    field[n++] = {bits, kind, packedShift(step)};               \
+  }
+#define PACKED_ADD_PER_IMU(name, scope, count, bits, step, kind) \
+  for (int i = 0; i < (count) && (scope) == PACKED_PER_IMU; i++) \
+  {                                                              \
+    field[n++] = {bits, kind, packedShift(step)};                \
+  }
+    PACKED_FRAME_SCHEMA(PACKED_ADD_ONCE)
+    for (int imu = 0; imu < IMU_COUNT; imu++)
+    {
+      PACKED_FRAME_SCHEMA(PACKED_ADD_PER_IMU)
+    }
+#undef PACKED_ADD_ONCE
+#undef PACKED_ADD_PER_IMU
+  }
+};
+
+static constexpr PackedLayout packedLayout{};
+
+static_assert(packedLayout.field[0].kind == PACKED_WRAP && packedLayout.field[1].kind == PACKED_WRAP,
+              "sequence and capture come first and wrap");
+
+// Range of a wrapping field in frame units, a power of two
+constexpr uint32_t packedSpan(int field)
+{
+  return 1u << (packedLayout.field[field].shift + packedLayout.field[field].bits);
+}
+
+// Rounded to the nearest step, ties up, then clamped to the field
+inline uint32_t packedQuantize(int32_t value, const PackedField &field)
+{
+  int32_t q = (value + ((1 << field.shift) >> 1)) >> field.shift;
+  int32_t low = field.kind == PACKED_SIGNED ? -(1 << (field.bits - 1)) : 0;
+  int32_t high = field.kind == PACKED_SIGNED ? (1 << (field.bits - 1)) - 1 : (1 << field.bits) - 1;
+  return (uint32_t)(q < low ? low : q > high ? high : q);
+}
+
+inline size_t packFrame(const int16_t *values, uint16_t sequence, uint32_t captureUs, uint8_t *out)
+{
+  uint64_t bits = 0;
+  int held = 0;
+  size_t at = 0;
+#pragma GCC unroll 64 // Every field's width and shift become constants
+  for (int i = 0; i < PACKED_FIELDS; i++)
+  {
+    const PackedField &field = packedLayout.field[i];
+    uint32_t counter = i == 0 ? sequence : captureUs;
+    uint32_t q = field.kind == PACKED_WRAP ? counter >> field.shift : packedQuantize(values[i - 2], field);
+    bits |= (uint64_t)(q & ((1u << field.bits) - 1)) << held;
+    held += field.bits;
+    while (held >= 8)
+    {
+      out[at++] = (uint8_t)bits;
+      bits >>= 8;
+      held -= 8;
+    }
+  }
+  if (held > 0)
+  {
+    out[at++] = (uint8_t)bits; // Unused high bits of the last byte are zero
+  }
+  return at;
+}
+
+// The next field of a bit stream being read
+struct PackedReader
+{
+  const uint8_t *in;
+  uint64_t bits;
+  int held;
+
+  uint32_t take(const PackedField &field)
+  {
+    while (held < field.bits)
+    {
+      bits |= (uint64_t)*in++ << held;
+      held += 8;
+    }
+    uint32_t q = (uint32_t)bits & ((1u << field.bits) - 1);
+    bits >>= field.bits;
+    held -= field.bits;
+    return q;
+  }
+};
+
+// Wrapping fields come back as their low bits, see packedUnwrap()
+inline bool unpackFrame(const uint8_t *in, size_t length, int16_t *values, uint16_t *sequence, uint32_t *captureUs)
+{
+  if (length != PACKED_FRAME_SIZE)
+  {
+    return false;
+  }
+  PackedReader reader = {in, 0, 0};
+  *sequence = (uint16_t)(reader.take(packedLayout.field[0]) << packedLayout.field[0].shift);
+  *captureUs = reader.take(packedLayout.field[1]) << packedLayout.field[1].shift;
+#pragma GCC unroll 64
+  for (int i = 2; i < PACKED_FIELDS; i++)
+  {
+    const PackedField &field = packedLayout.field[i];
+    uint32_t q = reader.take(field);
+    int32_t value = field.kind == PACKED_SIGNED && (q >> (field.bits - 1)) ? (int32_t)q - (1 << field.bits) : (int32_t)q;
+    values[i - 2] = (int16_t)(value * (1 << field.shift));
+  }
+  return true;
+}
+
+// The counter value within half a span of `reference` whose low bits are
+// `packed`, e.g. against the previous frame's, or the glove clock estimated
+// from a clock sync for the first frame.
+inline uint32_t packedUnwrap(uint32_t packed, uint32_t reference, uint32_t span)
+{
+  uint32_t delta = (packed - reference) & (span - 1);
+  return delta < span / 2 ? reference + delta : reference + delta - span;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include "MicroBench.h"
+#include "StageProfiler.h"
+#include <stdio.h>
+#include <string.h>
+
+static BenchRegistration *benchmarks = NULL;
+static BenchRegistration **benchmarksTail = &benchmarks;
+
+// Appended, so benchmarks run in the order of the source files
+BenchRegistration::BenchRegistration(const char *benchName, BenchFunction benchFunction)
+    : name(benchName), function(benchFunction), next(NULL)
+{
+  *benchmarksTail = this;
+  benchmarksTail = &next;
+}
+
+static uint32_t timeRun(BenchFunction function, uint32_t iterations, uint32_t *items)
+{
+  BenchState state(iterations);
+  uint32_t start = profileTicks();
+  function(state);
+  uint32_t ticks = profileTicks() - start;
+  *items = state.itemsPerIteration();
+  return ticks;
+}
+
+static BenchResult measure(const BenchRegistration &benchmark)
+{
+  uint32_t minTicks = BENCH_MIN_RUN_US * profileTicksPerUs();
+  uint32_t items;
+  timeRun(benchmark.function, 0, &items); // Untimed, for whatever the benchmark sets up before its loop
+  uint32_t iterations = 1;
+  uint32_t ticks = timeRun(benchmark.function, iterations, &items);
+  while (ticks < minTicks && iterations < BENCH_MAX_ITERATIONS)
+  {
+    iterations *= 2;
+    ticks = timeRun(benchmark.function, iterations, &items);
+  }
+  for (int i = 1; i < BENCH_REPETITIONS; i++)
+  {
+    uint32_t again = timeRun(benchmark.function, iterations, &items);
+    ticks = again < ticks ? again : ticks;
+  }
+
+  BenchResult result;
+  result.name = benchmark.name;
+  result.iterations = iterations;
+  double perItem = (double)ticks / iterations / items;
+  result.nsPerItem = perItem * 1000.0 / profileTicksPerUs();
+#ifdef ARDUINO
+  result.cyclesPerItem = perItem;
+#else
+  result.cyclesPerItem = 0;
+#endif
+  return result;
+}
+
+void runBenchmarks(const char *filter, void (*print)(const char *line))
+{
+  char line[96];
+  snprintf(line, sizeof(line), "# %u ticks per us, best of %d runs of at least %d us", (unsigned)profileTicksPerUs(),
+           BENCH_REPETITIONS, BENCH_MIN_RUN_US);
+  print(line);
+  print("name,iterations,ns_per_item,cycles_per_item");
+  for (BenchRegistration *benchmark = benchmarks; benchmark; benchmark = benchmark->next)
+  {
+    if (filter && !strstr(benchmark->name, filter))
+    {
+      continue;
+    }
+    BenchResult result = measure(*benchmark);
+    snprintf(line, sizeof(line), "%s,%u,%.2f,%.1f", result.name, (unsigned)result.iterations, result.nsPerItem,
+             result.cyclesPerItem);
+    print(line);
+  }
+}
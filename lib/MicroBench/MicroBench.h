@@ -0,0 +1,80 @@
+#ifndef MICRO_BENCH_H
+#define MICRO_BENCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Micro-benchmarks that run the same way on the host and on the glove.
+//
+//   MICROBENCH(crc16_512)
+//   {
+//     while (state.keepRunning())
+//     {
+//       benchKeep(crc16(buffer, 512));
+//     }
+//   }
+//
+// The runner doubles the iteration count until one run takes at least
+// BENCH_MIN_RUN_US, then repeats that run BENCH_REPETITIONS times and keeps
+// the fastest, which is the one least disturbed by interrupts and other
+// tasks. Time comes from profileTicks() (StageProfiler.h): CPU cycles on the
+// ESP32, nanoseconds on the host.
+//
+// Results are CSV, one line per benchmark after a header, with '#' comment
+// lines around them, the same on the serial port as on stdout.
+
+#define BENCH_MIN_RUN_US 50000
+#define BENCH_REPETITIONS 5
+#define BENCH_MAX_ITERATIONS (1u << 26)
+
+class BenchState
+{
+public:
+  explicit BenchState(uint32_t iterations) : remaining(iterations), items(1) {}
+
+  bool keepRunning() { return remaining-- > 0; }
+  void setItemsPerIteration(uint32_t count) { items = count; } // Reported per item, e.g. per frame of a batch
+  uint32_t itemsPerIteration() const { return items; }
+
+private:
+  uint32_t remaining;
+  uint32_t items;
+};
+
+typedef void (*BenchFunction)(BenchState &state);
+
+struct BenchResult
+{
+  const char *name;
+  uint32_t iterations; // Per repetition
+  double nsPerItem;
+  double cyclesPerItem; // 0 where the clock isn't the CPU's (the host)
+};
+
+// Benchmarks add themselves to a list from static constructors
+struct BenchRegistration
+{
+  BenchRegistration(const char *name, BenchFunction function);
+
+  const char *name;
+  BenchFunction function;
+  BenchRegistration *next;
+};
+
+#define MICROBENCH(name)                                                 \
+  static void bench_##name(BenchState &state);                           \
+  static BenchRegistration benchRegistration_##name(#name, bench_##name); \
+  static void bench_##name(BenchState &state)
+
+// Keeps the compiler from dropping a result that is never used
+template <typename T>
+inline void benchKeep(const T &value)
+{
+  __asm__ __volatile__("" : : "r"(&value) : "memory");
+}
+
+// Runs every benchmark whose name contains `filter` (all for NULL), `print` receives the CSV line by line
+// (without the newline)
+void runBenchmarks(const char *filter, void (*print)(const char *line));
+
+#endif
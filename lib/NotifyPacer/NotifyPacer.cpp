@@ -0,0 +1,183 @@
+#include "NotifyPacer.h"
+#include <string.h>
+
+NotifyPacer::NotifyPacer() : maxBatch(1)
+{
+  reset(0);
+}
+
+void NotifyPacer::reset(uint32_t nowMs)
+{
+  memset(&stats, 0, sizeof(stats));
+  stats.batch = 1;
+  stats.decimation = 1;
+  frameCount = 0;
+  submittedBytes = 0;
+  submittedCount = 0;
+  windowBytes = 0;
+  completedOk = 0;
+  completedFailed = 0;
+  congested = false;
+  congestedInWindow = false;
+  windowStart = nowMs;
+  windowOk = 0;
+  windowFailed = 0;
+  backedUpInWindow = false;
+  cleanWindows = 0;
+}
+
+void NotifyPacer::setMaxBatch(uint8_t frames)
+{
+  maxBatch = frames < 1 ? 1 : frames > PACER_MAX_BATCH ? PACER_MAX_BATCH : frames;
+  if (stats.batch > maxBatch)
+  {
+    stats.batch = maxBatch;
+  }
+}
+
+bool NotifyPacer::takeFrame()
+{
+  if (frameCount++ % stats.decimation != 0)
+  {
+    stats.decimated++;
+    return false;
+  }
+  return true;
+}
+
+// Signed, completions from another task may briefly run ahead of the submit count
+int32_t NotifyPacer::inFlight() const
+{
+  return (int32_t)(submittedCount - completedOk - completedFailed);
+}
+
+bool NotifyPacer::canSubmit() const
+{
+  return !congested && inFlight() < PACER_MAX_IN_FLIGHT;
+}
+
+void NotifyPacer::submitted(size_t bytes)
+{
+  submittedCount++;
+  windowBytes += (uint32_t)bytes;
+  if (inFlight() >= PACER_MAX_IN_FLIGHT)
+  {
+    backedUpInWindow = true;
+  }
+}
+
+void NotifyPacer::completed(bool ok)
+{
+  if (ok)
+  {
+    completedOk++;
+  }
+  else
+  {
+    completedFailed++;
+  }
+}
+
+void NotifyPacer::setCongested(bool state)
+{
+  congested = state;
+  if (state)
+  {
+    congestedInWindow = true;
+  }
+}
+
+bool NotifyPacer::update(uint32_t nowMs)
+{
+  uint32_t elapsed = nowMs - windowStart;
+  if (elapsed < PACER_WINDOW_MS)
+  {
+    return false;
+  }
+
+  uint32_t ok = completedOk;
+  uint32_t failedTotal = completedFailed; // Read once, completions keep arriving meanwhile
+  uint32_t delivered = ok - windowOk;
+  uint32_t failed = failedTotal - windowFailed;
+  stats.failed += failed;
+  stats.submitted = submittedCount;
+  submittedBytes += windowBytes.exchange(0);
+
+  // Bytes per notification averaged over the connection, completions carry no length
+  uint32_t averageBytes = stats.submitted ? (uint32_t)(submittedBytes / stats.submitted) : 0;
+  uint32_t bps = (uint32_t)((uint64_t)delivered * averageBytes * 1000 / elapsed);
+  stats.throughputBps = stats.throughputBps - stats.throughputBps / 4 + bps / 4; // EWMA, 1/4 weight
+
+  uint8_t batch = stats.batch;
+  uint8_t decimation = stats.decimation;
+  if (failed > 0 || congestedInWindow || backedUpInWindow)
+  {
+    backOff();
+    cleanWindows = 0;
+  }
+  else if (++cleanWindows >= PACER_RECOVER_WINDOWS)
+  {
+    recover();
+    cleanWindows = 0;
+  }
+
+  windowStart = nowMs;
+  windowOk = ok;
+  windowFailed = failedTotal;
+  congestedInWindow = congested.load();
+  backedUpInWindow = false;
+  return batch != stats.batch || decimation != stats.decimation;
+}
+
+// Multiplicative on the way down so a collapsing link is caught quickly
+void NotifyPacer::backOff()
+{
+  if (stats.batch < maxBatch)
+  {
+    stats.batch = (stats.batch * 2 > maxBatch) ? maxBatch : stats.batch * 2;
+  }
+  else if (stats.decimation < PACER_MAX_DECIMATION)
+  {
+    stats.decimation *= 2;
+  }
+}
+
+// One step at a time on the way up
+void NotifyPacer::recover()
+{
+  if (stats.decimation > 1)
+  {
+    stats.decimation /= 2;
+  }
+  else if (stats.batch > 1)
+  {
+    stats.batch--;
+  }
+}
+
+static uint8_t *putU32(uint8_t *out, uint32_t value)
+{
+  out[0] = value;
+  out[1] = value >> 8;
+  out[2] = value >> 16;
+  out[3] = value >> 24;
+  return out + 4;
+}
+
+size_t NotifyPacer::serialize(uint8_t *out, size_t capacity) const
+{
+  if (capacity < LINK_STATS_WIRE_SIZE)
+  {
+    return 0;
+  }
+  out = putU32(out, submittedCount);
+  out = putU32(out, stats.failed);
+  out = putU32(out, stats.decimated);
+  out = putU32(out, stats.dropped);
+  out = putU32(out, stats.throughputBps);
+  out[0] = stats.batch;
+  out[1] = stats.decimation;
+  out[2] = 0;
+  out[3] = 0;
+  return LINK_STATS_WIRE_SIZE;
+}
@@ -0,0 +1,95 @@
+#ifndef NOTIFY_PACER_H
+#define NOTIFY_PACER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Matches the frame stream to what the BLE link actually delivers.
+//
+// Every notification handed to the stack is counted as submitted, and its
+// completion (or failure) is reported back from the GATT server events.
+// Once per PACER_WINDOW_MS the pacer looks at what happened in the window:
+// failures, a congestion event or too many notifications still in flight
+// make it back off, a run of clean windows lets it recover.
+//
+// Backing off first packs more frames into one notification (fewer, larger
+// packets, every sample still arrives), and only when batches are as large
+// as the MTU allows does it start sending just every n-th frame. Recovery
+// undoes the decimation first, then the batching.
+//
+// submitted(), completed() and setCongested() may be called from any task
+// (replies sent from the BLE task count against the same link), everything
+// else belongs to the task that sends the frames.
+
+#define PACER_WINDOW_MS 500
+#define PACER_RECOVER_WINDOWS 4 // Clean windows in a row before stepping back up
+#define PACER_MAX_BATCH 8       // Frames per notification
+#define PACER_MAX_DECIMATION 8  // Send one of this many frames at most
+#define PACER_MAX_IN_FLIGHT 6   // Submitted but not completed before the link counts as backed up
+
+#define LINK_STATS_WIRE_SIZE 24 // Payload of MSG_LINK, see NotifyPacer::serialize
+
+struct LinkStats
+{
+  uint32_t submitted;     // Notifications handed to the stack, as of the last window
+  uint32_t failed;        // Completed with an error
+  uint32_t decimated;     // Frames skipped to lower the rate
+  uint32_t dropped;       // Frames lost because the link stalled with a full batch
+  uint32_t throughputBps; // Smoothed delivered payload bytes per second
+  uint8_t batch;
+  uint8_t decimation;
+};
+
+class NotifyPacer
+{
+public:
+  NotifyPacer();
+
+  void reset(uint32_t nowMs);       // New connection, start at full rate
+  void setMaxBatch(uint8_t frames); // From the negotiated MTU
+
+  bool takeFrame();                         // A frame is due, false when decimated away
+  bool canSubmit() const;                   // Room in flight for another notification
+  void submitted(size_t bytes);             // A notification was handed to the stack, any task
+  void completed(bool ok);                  // From the GATT server event, any task
+  void setCongested(bool congested);        // From the GATT server event, any task
+  void frameDropped() { stats.dropped++; }  // Oldest batched frame was overwritten
+
+  // Close the window if it is over, returns true when batch or decimation changed
+  bool update(uint32_t nowMs);
+
+  uint8_t batchSize() const { return stats.batch; }
+  uint8_t maxBatchSize() const { return maxBatch; }
+  uint8_t decimation() const { return stats.decimation; }
+  const LinkStats &linkStats() const { return stats; }
+
+  // submitted, failed, decimated, dropped, throughput as LE uint32, then batch, decimation, 2 reserved
+  size_t serialize(uint8_t *out, size_t capacity) const;
+
+private:
+  int32_t inFlight() const;
+  void backOff();
+  void recover();
+
+  LinkStats stats;
+  uint8_t maxBatch;
+  uint32_t frameCount;
+  uint64_t submittedBytes; // Folded in from windowBytes once per window
+
+  // Updated from any task
+  std::atomic<uint32_t> submittedCount;
+  std::atomic<uint32_t> windowBytes; // Submitted since the last window
+  std::atomic<uint32_t> completedOk;
+  std::atomic<uint32_t> completedFailed;
+  std::atomic<bool> congested;
+  std::atomic<bool> congestedInWindow;
+  std::atomic<bool> backedUpInWindow;
+
+  uint32_t windowStart;
+  uint32_t windowOk;     // completedOk at the start of the window
+  uint32_t windowFailed; // completedFailed at the start of the window
+  uint8_t cleanWindows;
+};
+
+#endif
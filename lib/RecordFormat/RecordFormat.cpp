@@ -0,0 +1,188 @@
+#include "RecordFormat.h"
+#include "FrameFormat.h"
+#include "GloveProtocol.h"
+#include <string.h>
+
+static size_t putVarint(uint8_t *out, uint32_t value)
+{
+  size_t n = 0;
+  while (value >= 0x80)
+  {
+    out[n++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+// Bounded by `end`, false on a varint that runs off the data or past 32 bits
+static bool getVarint(const uint8_t *data, size_t *position, size_t end, uint32_t *value)
+{
+  uint32_t result = 0;
+  for (int shift = 0; shift < 35; shift += 7)
+  {
+    if (*position >= end)
+    {
+      return false;
+    }
+    uint8_t byte = data[(*position)++];
+    result |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+    {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+static uint32_t zigzag(int32_t value)
+{
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value)
+{
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+void SegmentWriter::begin(uint8_t *buffer, uint32_t segmentSequence)
+{
+  segment = buffer;
+  length = RECORD_HEADER_SIZE;
+  frames = 0;
+  sequence = segmentSequence;
+  firstUs = 0;
+  lastUs = 0;
+  memset(last, 0, sizeof(last));
+}
+
+bool SegmentWriter::add(const int16_t *values, uint32_t captureUs)
+{
+  if (length + RECORD_MAX_FRAME_BYTES > RECORD_SEGMENT_SIZE || frames == UINT16_MAX)
+  {
+    return false;
+  }
+  if (frames == 0)
+  {
+    firstUs = lastUs = captureUs;
+  }
+  uint8_t *out = segment + length;
+  size_t n = putVarint(out, captureUs - lastUs);
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    n += putVarint(out + n, zigzag((int32_t)values[i] - last[i]));
+    last[i] = values[i];
+  }
+  length += n;
+  lastUs = captureUs;
+  frames++;
+  return true;
+}
+
+void SegmentWriter::seal()
+{
+  putLE(segment, RECORD_MAGIC, 4);
+  segment[4] = RECORD_VERSION;
+  segment[5] = FRAME_VALUES;
+  putLE(segment + 6, frames, 2);
+  putLE(segment + 8, sequence, 4);
+  putLE(segment + 12, firstUs, 4);
+  putLE(segment + 16, length - RECORD_HEADER_SIZE, 2);
+  uint16_t crc = crc16(segment, 18);
+  crc = crc16(segment + RECORD_HEADER_SIZE, length - RECORD_HEADER_SIZE, crc);
+  putLE(segment + 18, crc, 2);
+  memset(segment + length, 0xFF, RECORD_SEGMENT_SIZE - length); // Erased flash, cheapest to program
+}
+
+SegmentStatus readSegmentHeader(const uint8_t *segment, SegmentHeader *header)
+{
+  uint32_t magic = (uint32_t)getLE(segment, 4);
+  if (magic == 0xFFFFFFFFu)
+  {
+    return SEGMENT_ERASED;
+  }
+  if (magic != RECORD_MAGIC)
+  {
+    return SEGMENT_BAD_MAGIC;
+  }
+  if (segment[4] != RECORD_VERSION)
+  {
+    return SEGMENT_BAD_VERSION;
+  }
+  header->valueCount = segment[5];
+  header->frameCount = (uint16_t)getLE(segment + 6, 2);
+  header->sequence = (uint32_t)getLE(segment + 8, 4);
+  header->firstUs = (uint32_t)getLE(segment + 12, 4);
+  header->dataLength = (uint16_t)getLE(segment + 16, 2);
+  if (header->valueCount != FRAME_VALUES || header->dataLength > RECORD_SEGMENT_SIZE - RECORD_HEADER_SIZE)
+  {
+    return SEGMENT_BAD_LENGTH;
+  }
+  uint16_t crc = crc16(segment, 18);
+  crc = crc16(segment + RECORD_HEADER_SIZE, header->dataLength, crc);
+  if (crc != (uint16_t)getLE(segment + 18, 2))
+  {
+    return SEGMENT_BAD_CRC;
+  }
+  return SEGMENT_OK;
+}
+
+SegmentStatus SegmentReader::begin(const uint8_t *segment)
+{
+  SegmentStatus status = readSegmentHeader(segment, &info);
+  data = segment + RECORD_HEADER_SIZE;
+  position = 0;
+  remaining = status == SEGMENT_OK ? info.frameCount : 0;
+  lastUs = info.firstUs;
+  memset(last, 0, sizeof(last));
+  return status;
+}
+
+bool SegmentReader::next(int16_t *values, uint32_t *captureUs)
+{
+  if (remaining == 0)
+  {
+    return false;
+  }
+  uint32_t value;
+  if (!getVarint(data, &position, info.dataLength, &value))
+  {
+    position = info.dataLength; // Stays at the end, remainingFrames() tells what was lost
+    return false;
+  }
+  lastUs += value;
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    if (!getVarint(data, &position, info.dataLength, &value))
+    {
+      position = info.dataLength;
+      return false;
+    }
+    last[i] = (int16_t)(uint16_t)((uint16_t)last[i] + (uint16_t)unzigzag(value)); // Wraps like the int16 it was written from
+  }
+  memcpy(values, last, sizeof(last));
+  *captureUs = lastUs;
+  remaining--;
+  return true;
+}
+
+const char *segmentStatusName(SegmentStatus status)
+{
+  switch (status)
+  {
+  case SEGMENT_OK:
+    return "ok";
+  case SEGMENT_ERASED:
+    return "erased";
+  case SEGMENT_BAD_MAGIC:
+    return "bad magic";
+  case SEGMENT_BAD_VERSION:
+    return "bad version";
+  case SEGMENT_BAD_LENGTH:
+    return "bad length";
+  case SEGMENT_BAD_CRC:
+    return "bad crc";
+  }
+  return "?";
+}
@@ -0,0 +1,92 @@
+#ifndef RECORD_FORMAT_H
+#define RECORD_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "GlovePipeline.h"
+
+// Append-only recording format, written by the firmware recorder and read by the host tools.
+//
+// A recording is a file of RECORD_SEGMENT_SIZE segments. Each segment stands on
+// its own, so a torn write or a bad sector only costs the frames inside it:
+//
+//   magic u32 "GREC", version u8, value count u8, frame count u16,
+//   segment sequence u32, capture time of the first frame u32 (us),
+//   data length u16, CRC-16/CCITT-FALSE u16 of the header bytes before it and the data
+//
+// then the frames, padded with 0xFF to the segment size. A frame is the capture
+// time since the previous frame as an unsigned varint, followed by each value
+// as a zigzag varint of its change since the previous frame. The first frame of
+// a segment starts from zero values and the header time. Header fields are
+// little endian.
+
+#define RECORD_SEGMENT_SIZE 4096 // One flash sector
+#define RECORD_HEADER_SIZE 20
+#define RECORD_MAGIC 0x43455247u // "GREC"
+#define RECORD_VERSION 1
+#define RECORD_MAX_FRAME_BYTES (5 + FRAME_VALUES * 3) // Every varint at its longest
+
+struct SegmentHeader
+{
+  uint8_t valueCount;
+  uint16_t frameCount;
+  uint32_t sequence;
+  uint32_t firstUs;
+  uint16_t dataLength;
+};
+
+enum SegmentStatus : uint8_t
+{
+  SEGMENT_OK,
+  SEGMENT_ERASED,      // Never written, all 0xFF
+  SEGMENT_BAD_MAGIC,
+  SEGMENT_BAD_VERSION,
+  SEGMENT_BAD_LENGTH,
+  SEGMENT_BAD_CRC
+};
+
+// Fills one segment buffer frame by frame
+class SegmentWriter
+{
+public:
+  void begin(uint8_t *segment, uint32_t sequence);
+  bool add(const int16_t *values, uint32_t captureUs); // False when the segment is full, nothing written then
+  void seal();                                         // Header, CRC and padding, the buffer is ready for flash
+
+  uint16_t frameCount() const { return frames; }
+
+private:
+  uint8_t *segment;
+  size_t length;
+  uint16_t frames;
+  uint32_t sequence;
+  uint32_t firstUs;
+  uint32_t lastUs;
+  int16_t last[FRAME_VALUES];
+};
+
+// Checks the header and CRC of a whole segment
+SegmentStatus readSegmentHeader(const uint8_t *segment, SegmentHeader *header);
+
+// Walks the frames of a segment that passed readSegmentHeader
+class SegmentReader
+{
+public:
+  SegmentStatus begin(const uint8_t *segment);
+  bool next(int16_t *values, uint32_t *captureUs); // False at the end, or on a frame that doesn't decode
+
+  const SegmentHeader &header() const { return info; }
+  uint16_t remainingFrames() const { return remaining; } // Frames not decoded yet
+
+private:
+  const uint8_t *data;
+  size_t position;
+  uint16_t remaining;
+  SegmentHeader info;
+  uint32_t lastUs;
+  int16_t last[FRAME_VALUES];
+};
+
+const char *segmentStatusName(SegmentStatus status);
+
+#endif
@@ -0,0 +1,216 @@
+#include "RecordReader.h"
+#include "FrameFormat.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char *fingerNames[] = {"thumb", "index", "middle", "ring", "pinky"};
+static const char *imuValueNames[IMU_VALUES] = {"gyro_x", "gyro_y", "gyro_z", "accel_x", "accel_y", "accel_z"};
+static char channelNames[CHANNEL_COUNT][16]; // Filled in on first use
+
+const char *channelName(int channel)
+{
+  if (channel < 0 || channel >= CHANNEL_COUNT)
+  {
+    return "?";
+  }
+  char *name = channelNames[channel];
+  size_t capacity = sizeof(channelNames[0]);
+  if (name[0] != '\0')
+  {
+    return name;
+  }
+  int fingers = (int)(sizeof(fingerNames) / sizeof(fingerNames[0]));
+  if (channel < fingers && channel < FLEX_COUNT)
+  {
+    snprintf(name, capacity, "%s", fingerNames[channel]);
+  }
+  else if (channel < FLEX_COUNT)
+  {
+    snprintf(name, capacity, "flex%d", channel);
+  }
+  else
+  {
+    int imu = (channel - FLEX_COUNT) / IMU_VALUES;
+    const char *value = imuValueNames[(channel - FLEX_COUNT) % IMU_VALUES];
+    if (imu == 0)
+    {
+      snprintf(name, capacity, "%s", value);
+    }
+    else
+    {
+      snprintf(name, capacity, "imu%d_%s", imu, value);
+    }
+  }
+  return name;
+}
+
+bool RecordingFile::open(const char *path)
+{
+  close();
+  int fd = ::open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  length = (size_t)info.st_size;
+  if (length == 0)
+  {
+    ::close(fd);
+    return true; // Nothing recorded yet, mmap refuses empty files
+  }
+  void *map = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // The mapping keeps the file open
+  if (map == MAP_FAILED)
+  {
+    length = 0;
+    return false;
+  }
+  madvise(map, length, MADV_SEQUENTIAL); // Read ahead, segments are walked front to back
+  data = (const uint8_t *)map;
+  mapped = true;
+  return true;
+}
+
+void RecordingFile::attach(const uint8_t *bytes, size_t size)
+{
+  close();
+  data = bytes;
+  length = size;
+}
+
+void RecordingFile::close()
+{
+  if (mapped)
+  {
+    munmap((void *)data, length);
+  }
+  data = NULL;
+  length = 0;
+  mapped = false;
+}
+
+FrameCursor::FrameCursor(const RecordingFile &file)
+    : file(file), index(0), inSegment(false), wraps(0), lastUs(0), first(true), bad(0), lost(0)
+{
+}
+
+bool FrameCursor::nextSegment()
+{
+  while (index < file.segmentCount())
+  {
+    SegmentStatus status = reader.begin(file.segment(index++));
+    if (status == SEGMENT_OK)
+    {
+      return true;
+    }
+    if (status != SEGMENT_ERASED)
+    {
+      bad++;
+    }
+  }
+  return false;
+}
+
+bool FrameCursor::next(RecordedFrame *frame)
+{
+  uint32_t captureUs;
+  for (;;)
+  {
+    if (inSegment)
+    {
+      if (reader.next(frame->values, &captureUs))
+      {
+        break;
+      }
+      lost += reader.remainingFrames();
+    }
+    inSegment = nextSegment();
+    if (!inSegment)
+    {
+      return false;
+    }
+  }
+  if (!first && captureUs < lastUs && lastUs - captureUs > 0x80000000u)
+  {
+    wraps += 1ull << 32; // The glove's 32-bit microsecond clock rolled over, every 71 minutes
+  }
+  first = false;
+  lastUs = captureUs;
+  frame->timeUs = wraps + captureUs;
+  return true;
+}
+
+void FrameColumns::clear()
+{
+  timeUs.clear();
+  for (int c = 0; c < CHANNEL_COUNT; c++)
+  {
+    channels[c].clear();
+  }
+}
+
+size_t readColumns(const RecordingFile &file, FrameColumns *columns)
+{
+  // Frame counts from the headers, unchecked, only to size the columns once
+  size_t expected = 0;
+  for (size_t i = 0; i < file.segmentCount(); i++)
+  {
+    expected += (size_t)getLE(file.segment(i) + 6, 2);
+  }
+  columns->clear();
+  columns->timeUs.reserve(expected);
+  for (int c = 0; c < CHANNEL_COUNT; c++)
+  {
+    columns->channels[c].reserve(expected);
+  }
+
+  FrameCursor cursor(file);
+  RecordedFrame frame;
+  while (cursor.next(&frame))
+  {
+    columns->timeUs.push_back(frame.timeUs);
+    for (int c = 0; c < CHANNEL_COUNT; c++)
+    {
+      columns->channels[c].push_back(frame.values[c]);
+    }
+  }
+  return columns->size();
+}
+
+static bool writePadded(FILE *out, const void *bytes, size_t length)
+{
+  static const uint8_t zeros[8] = {0};
+  size_t padding = (8 - length % 8) % 8;
+  return fwrite(bytes, 1, length, out) == length && fwrite(zeros, 1, padding, out) == padding;
+}
+
+// Host byte order is written as is, the columnar format is little endian like every supported host
+bool writeColumns(const char *path, const FrameColumns &columns)
+{
+  FILE *out = fopen(path, "wb");
+  if (!out)
+  {
+    return false;
+  }
+  uint8_t header[COLUMNS_HEADER_SIZE] = {0};
+  putLE(header, COLUMNS_MAGIC, 4);
+  header[4] = COLUMNS_VERSION;
+  header[5] = CHANNEL_COUNT;
+  putLE(header + 8, columns.size(), 8);
+  bool ok = fwrite(header, 1, sizeof(header), out) == sizeof(header);
+  ok = ok && writePadded(out, columns.timeUs.data(), columns.size() * sizeof(uint64_t));
+  for (int c = 0; c < CHANNEL_COUNT && ok; c++)
+  {
+    ok = writePadded(out, columns.channels[c].data(), columns.size() * sizeof(int16_t));
+  }
+  return fclose(out) == 0 && ok;
+}
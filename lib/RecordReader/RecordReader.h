@@ -0,0 +1,104 @@
+#ifndef RECORD_READER_H
+#define RECORD_READER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "RecordFormat.h"
+
+// Host side reading of recordings (see RecordFormat.h), for offline analysis.
+//
+// RecordingFile maps a .rec file read-only; FrameCursor decodes frames
+// straight out of the mapping, segment by segment, without copying or
+// allocating. readColumns() turns a recording into one contiguous array per
+// channel so filters and classifiers can run over whole columns at once.
+//
+// POSIX only (mmap).
+
+#define CHANNEL_COUNT FRAME_VALUES // One channel per frame value, in frame order
+
+// Label of a channel, from the channel counts of the build (GlovePipeline.h):
+// thumb, index, middle, ring, pinky, then flex5, flex6... for further flex
+// channels, gyro_x .. accel_z for the first IMU and imu1_gyro_x.. for the next.
+// A five finger, one IMU glove keeps the labels it always had.
+const char *channelName(int channel);
+
+class RecordingFile
+{
+public:
+  RecordingFile() : data(NULL), length(0), mapped(false) {}
+  ~RecordingFile() { close(); }
+  RecordingFile(const RecordingFile &) = delete;
+  RecordingFile &operator=(const RecordingFile &) = delete;
+
+  bool open(const char *path);                // Maps the whole file, false if it can't
+  void attach(const uint8_t *bytes, size_t size); // Reads a recording already in memory
+  void close();
+
+  size_t segmentCount() const { return length / RECORD_SEGMENT_SIZE; }
+  const uint8_t *segment(size_t index) const { return data + index * RECORD_SEGMENT_SIZE; }
+  size_t size() const { return length; }
+
+private:
+  const uint8_t *data;
+  size_t length;
+  bool mapped;
+};
+
+struct RecordedFrame
+{
+  uint64_t timeUs; // Capture time, unwrapped past the 32-bit glove clock
+  int16_t values[FRAME_VALUES];
+};
+
+// Walks every frame of the segments that pass their CRC, in file order
+class FrameCursor
+{
+public:
+  explicit FrameCursor(const RecordingFile &file);
+  bool next(RecordedFrame *frame);
+
+  uint32_t badSegments() const { return bad; } // Skipped for a bad header or CRC
+  uint32_t lostFrames() const { return lost; } // Frames in segments that stopped decoding early
+
+private:
+  bool nextSegment();
+
+  const RecordingFile &file;
+  SegmentReader reader;
+  size_t index;
+  bool inSegment;
+  uint64_t wraps;  // Multiple of 2^32 added to the glove clock
+  uint32_t lastUs;
+  bool first;
+  uint32_t bad;
+  uint32_t lost;
+};
+
+// Structure of arrays, column c holds channel c of every frame
+struct FrameColumns
+{
+  std::vector<uint64_t> timeUs;
+  std::vector<int16_t> channels[CHANNEL_COUNT];
+
+  size_t size() const { return timeUs.size(); }
+  void clear();
+};
+
+size_t readColumns(const RecordingFile &file, FrameColumns *columns); // Returns the frame count
+
+// Columnar file, little endian:
+//
+//   magic u32 "GCOL", version u8, channel count u8, reserved u16, frame count u64,
+//   time column (u64 us per frame), then one int16 column per channel,
+//   each column padded to a multiple of 8 bytes
+//
+// so numpy can map any column directly, e.g. channel c at
+// offset 16 + 8 * n + c * round_up(2 * n, 8).
+#define COLUMNS_MAGIC 0x4C4F4347u // "GCOL"
+#define COLUMNS_VERSION 1
+#define COLUMNS_HEADER_SIZE 16
+
+bool writeColumns(const char *path, const FrameColumns &columns);
+
+#endif
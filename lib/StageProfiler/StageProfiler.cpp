@@ -0,0 +1,174 @@
+#include "StageProfiler.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+StageProfiler profiler;
+
+static const char *stageNames[STAGE_COUNT] = {
+#define STAGE_LABEL(name, label) label,
+    X_STAGES(STAGE_LABEL)
+#undef STAGE_LABEL
+};
+
+uint32_t profileTicks()
+{
+#ifdef ARDUINO
+  uint32_t ccount;
+  __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount)); // Xtensa cycle counter
+  return ccount;
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+uint32_t profileTicksPerUs()
+{
+#ifdef ARDUINO
+  return getCpuFrequencyMhz();
+#else
+  return 1000; // Host ticks are nanoseconds
+#endif
+}
+
+StageProfiler::StageProfiler()
+{
+  reset();
+}
+
+void StageProfiler::reset()
+{
+  memset(histograms, 0, sizeof(histograms));
+  for (int i = 0; i < STAGE_COUNT; i++)
+  {
+    histograms[i].min = UINT32_MAX;
+  }
+}
+
+// Octave from the highest set bit, then the next PROFILE_SUB_BITS bits pick the bucket inside it
+int StageProfiler::bucketOf(uint32_t ticks)
+{
+  if (ticks < (1u << PROFILE_SUB_BITS))
+  {
+    return ticks;
+  }
+  int msb = 31 - __builtin_clz(ticks);
+  int sub = (ticks >> (msb - PROFILE_SUB_BITS)) & ((1 << PROFILE_SUB_BITS) - 1);
+  return ((msb - PROFILE_SUB_BITS + 1) << PROFILE_SUB_BITS) + sub;
+}
+
+uint32_t StageProfiler::bucketUpperBound(int bucket)
+{
+  if (bucket < (1 << PROFILE_SUB_BITS))
+  {
+    return bucket;
+  }
+  int msb = (bucket >> PROFILE_SUB_BITS) + PROFILE_SUB_BITS - 1;
+  int sub = bucket & ((1 << PROFILE_SUB_BITS) - 1);
+  uint64_t low = ((uint64_t)((1 << PROFILE_SUB_BITS) | sub)) << (msb - PROFILE_SUB_BITS);
+  uint64_t width = 1ull << (msb - PROFILE_SUB_BITS);
+  uint64_t high = low + width - 1;
+  return high > UINT32_MAX ? UINT32_MAX : (uint32_t)high;
+}
+
+void StageProfiler::record(Stage stage, uint32_t ticks)
+{
+  Histogram &h = histograms[stage];
+  h.buckets[bucketOf(ticks)]++;
+  h.count++;
+  h.sum += ticks;
+  if (ticks < h.min)
+  {
+    h.min = ticks;
+  }
+  if (ticks > h.max)
+  {
+    h.max = ticks;
+  }
+}
+
+uint32_t StageProfiler::ticksToNs(uint32_t ticks) const
+{
+  return (uint32_t)((uint64_t)ticks * 1000 / profileTicksPerUs());
+}
+
+StageStats StageProfiler::stats(Stage stage) const
+{
+  const Histogram &h = histograms[stage];
+  StageStats s = {0, 0, 0, 0, 0};
+  if (h.count == 0)
+  {
+    return s;
+  }
+
+  // p99 is the upper edge of the bucket holding the 99th percentile sample, capped at the real max
+  uint32_t rank = h.count - h.count / 100;
+  uint32_t seen = 0;
+  uint32_t p99 = h.max;
+  for (int b = 0; b < PROFILE_BUCKETS; b++)
+  {
+    seen += h.buckets[b];
+    if (seen >= rank)
+    {
+      p99 = bucketUpperBound(b) < h.max ? bucketUpperBound(b) : h.max;
+      break;
+    }
+  }
+
+  s.count = h.count;
+  s.minNs = ticksToNs(h.min);
+  s.meanNs = ticksToNs((uint32_t)(h.sum / h.count));
+  s.p99Ns = ticksToNs(p99);
+  s.maxNs = ticksToNs(h.max);
+  return s;
+}
+
+static uint8_t *putU32(uint8_t *out, uint32_t value)
+{
+  out[0] = value;
+  out[1] = value >> 8;
+  out[2] = value >> 16;
+  out[3] = value >> 24;
+  return out + 4;
+}
+
+size_t StageProfiler::serialize(uint8_t *out, size_t capacity) const
+{
+  size_t needed = 1 + STAGE_COUNT * STAGE_STATS_WIRE_SIZE;
+  if (capacity < needed)
+  {
+    return 0;
+  }
+  *out++ = STAGE_COUNT;
+  for (int i = 0; i < STAGE_COUNT; i++)
+  {
+    StageStats s = stats((Stage)i);
+    out = putU32(out, s.count);
+    out = putU32(out, s.minNs);
+    out = putU32(out, s.meanNs);
+    out = putU32(out, s.p99Ns);
+    out = putU32(out, s.maxNs);
+  }
+  return needed;
+}
+
+void StageProfiler::dump(FILE *out) const
+{
+  fprintf(out, "%-12s %10s %10s %10s %10s %10s\n", "stage", "count", "min_us", "mean_us", "p99_us", "max_us");
+  for (int i = 0; i < STAGE_COUNT; i++)
+  {
+    StageStats s = stats((Stage)i);
+    fprintf(out, "%-12s %10u %10.2f %10.2f %10.2f %10.2f\n", stageNames[i], (unsigned)s.count, s.minNs / 1000.0,
+            s.meanNs / 1000.0, s.p99Ns / 1000.0, s.maxNs / 1000.0);
+  }
+}
+
+const char *StageProfiler::stageName(Stage stage)
+{
+  return stage < STAGE_COUNT ? stageNames[stage] : "?";
+}
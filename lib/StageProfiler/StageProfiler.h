@@ -0,0 +1,119 @@
+#ifndef STAGE_PROFILER_H
+#define STAGE_PROFILER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Per-stage timing of the acquisition pipeline.
+// Wrap a stage in PROFILE_STAGE(STAGE_x) and its duration goes into a
+// log-linear histogram (4 buckets per power of two), from which min, mean,
+// p99 and max are reported. Timestamps are the Xtensa CCOUNT register on
+// the ESP32 and std::chrono on the host. Build with -D GLOVE_PROFILING=0
+// to remove the timers.
+//
+// Nothing is locked. Each stage must only be timed from one task, and stats(),
+// serialize() and dump() belong on the task that times most of them (loop() on
+// the glove), which hands copies to other tasks. A stage timed on another task
+// (the BLE callbacks) can be read halfway through a record(), its numbers are
+// then off by that one sample in that read.
+
+#ifndef GLOVE_PROFILING
+#define GLOVE_PROFILING 1
+#endif
+
+#define X_STAGES(X)      \
+  X(FRAME, "frame")      \
+  X(ADC, "adc")          \
+  X(IMU, "imu")          \
+  X(ANGLES, "angles")    \
+  X(NOTIFY, "notify")    \
+  X(DISPLAY, "display")  \
+  X(LOG, "log")          \
+  X(WRITE_CB, "on_write") \
+  X(CONNECT_CB, "on_connect") \
+  X(RECORD, "record")
+
+enum Stage : uint8_t
+{
+#define STAGE_ENUM(name, label) STAGE_##name,
+  X_STAGES(STAGE_ENUM)
+#undef STAGE_ENUM
+  STAGE_COUNT
+};
+
+#define PROFILE_SUB_BITS 2                          // Buckets per octave = 1 << PROFILE_SUB_BITS
+#define PROFILE_BUCKETS (32 << PROFILE_SUB_BITS)
+
+struct StageStats
+{
+  uint32_t count;
+  uint32_t minNs;
+  uint32_t meanNs;
+  uint32_t p99Ns;
+  uint32_t maxNs;
+};
+
+#define STAGE_STATS_WIRE_SIZE 20 // Five little endian uint32 per stage
+
+class StageProfiler
+{
+public:
+  StageProfiler();
+
+  void record(Stage stage, uint32_t ticks);
+  StageStats stats(Stage stage) const;
+  void reset();
+
+  // One byte stage count followed by STAGE_STATS_WIRE_SIZE bytes per stage, returns bytes written
+  size_t serialize(uint8_t *out, size_t capacity) const;
+  void dump(FILE *out) const;
+
+  static const char *stageName(Stage stage);
+
+private:
+  struct Histogram
+  {
+    uint32_t buckets[PROFILE_BUCKETS];
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+  };
+
+  static int bucketOf(uint32_t ticks);
+  static uint32_t bucketUpperBound(int bucket);
+  uint32_t ticksToNs(uint32_t ticks) const;
+
+  Histogram histograms[STAGE_COUNT];
+};
+
+extern StageProfiler profiler;
+
+// Free running tick counter and its rate
+uint32_t profileTicks();
+uint32_t profileTicksPerUs();
+
+class ScopedStage
+{
+public:
+  explicit ScopedStage(Stage stage) : stage(stage), start(profileTicks()) {}
+  ~ScopedStage() { profiler.record(stage, profileTicks() - start); }
+
+private:
+  Stage stage;
+  uint32_t start;
+};
+
+#if GLOVE_PROFILING
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+#define PROFILE_STAGE(stage) ScopedStage PROFILE_CONCAT(stageTimer_, __LINE__)(stage)
+#else
+#define PROFILE_STAGE(stage) \
+  do                         \
+  {                          \
+  } while (0)
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+#include "Advertiser.h"
+#include "BroadcastFormat.h"
+
+#define AD_TYPE_CONN_INTERVAL_RANGE 0x12
+
+static BLEAdvertising *advertising = NULL;
+static BLEUUID serviceUuid;
+static std::string deviceName;
+static char connIntervalRange[6]; // Whole AD structure for the scan response
+
+// Only loop() touches the advertiser, BLE callbacks and commands post events
+static bool full = false; // Every session slot is taken
+static bool broadcasting = false;
+static bool fast = false;
+static unsigned long fastSince = 0;
+
+static uint8_t broadcastData[BROADCAST_MAX_DATA];
+static size_t broadcastLength = 0;
+static uint8_t broadcastSequence = 0;
+
+// A 128-bit UUID and the name don't both fit in 31 bytes next to the letters, the name is left out then
+static void setData()
+{
+  BLEAdvertisementData data;
+  BLEAdvertisementData scanResponse;
+  data.setFlags(ESP_BLE_ADV_FLAG_GEN_DISC | ESP_BLE_ADV_FLAG_BREDR_NOT_SPT);
+  if (broadcasting)
+  {
+    data.setManufacturerData(std::string((const char *)broadcastData, broadcastLength));
+    scanResponse.setCompleteServices(serviceUuid);
+  }
+  else
+  {
+    data.setCompleteServices(serviceUuid);
+    scanResponse.setName(deviceName);
+  }
+  scanResponse.addData(std::string(connIntervalRange, sizeof(connIntervalRange)));
+  advertising->setAdvertisementData(data);
+  advertising->setScanResponseData(scanResponse);
+}
+
+static void restart()
+{
+  advertising->stop();
+  setData();
+  if (full)
+  {
+    if (!broadcasting)
+    {
+      return;
+    }
+    advertising->setAdvertisementType(ADV_TYPE_SCAN_IND);
+    advertising->setMinInterval(ADV_BROADCAST_MIN);
+    advertising->setMaxInterval(ADV_BROADCAST_MAX);
+  }
+  else if (fast)
+  {
+    advertising->setAdvertisementType(ADV_TYPE_IND);
+    advertising->setMinInterval(ADV_FAST_MIN);
+    advertising->setMaxInterval(ADV_FAST_MAX);
+  }
+  else
+  {
+    advertising->setAdvertisementType(ADV_TYPE_IND);
+    advertising->setMinInterval(broadcasting ? ADV_BROADCAST_MIN : ADV_SLOW_MIN);
+    advertising->setMaxInterval(broadcasting ? ADV_BROADCAST_MAX : ADV_SLOW_MAX);
+  }
+  advertising->start();
+}
+
+void advertiserBegin(BLEUUID service, const char *name, uint16_t minConnInterval, uint16_t maxConnInterval)
+{
+  advertising = BLEDevice::getAdvertising();
+  serviceUuid = service;
+  deviceName = name;
+  connIntervalRange[0] = 5;
+  connIntervalRange[1] = AD_TYPE_CONN_INTERVAL_RANGE;
+  connIntervalRange[2] = (char)minConnInterval;
+  connIntervalRange[3] = (char)(minConnInterval >> 8);
+  connIntervalRange[4] = (char)maxConnInterval;
+  connIntervalRange[5] = (char)(maxConnInterval >> 8);
+  broadcastLength = encodeBroadcast(broadcastSequence, "", 0, broadcastData);
+  advertiserStartFast();
+}
+
+void advertiserStartFast()
+{
+  fastSince = millis();
+  fast = true;
+  restart();
+}
+
+// The controller stops advertising when a central connects, restart it for the next one or as a broadcaster
+void advertiserConnected(bool isFull)
+{
+  full = isFull;
+  fast = false;
+  restart();
+}
+
+void advertiserDisconnected()
+{
+  full = false;
+  advertiserStartFast();
+}
+
+void advertiserUpdate()
+{
+  if (!full && fast && (millis() - fastSince) >= ADV_FAST_MS)
+  {
+    fast = false;
+    restart();
+  }
+}
+
+void advertiserSetBroadcast(bool enabled)
+{
+  if (enabled != broadcasting)
+  {
+    broadcasting = enabled;
+    restart();
+  }
+}
+
+void advertiserBroadcast(const char *text, size_t length)
+{
+  broadcastLength = encodeBroadcast(++broadcastSequence, text, length, broadcastData);
+  if (broadcasting)
+  {
+    setData(); // The controller swaps the payload without pausing advertising
+  }
+}
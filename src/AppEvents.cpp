@@ -0,0 +1,68 @@
+#include "AppEvents.h"
+#include <atomic>
+
+static QueueHandle_t appEvents = NULL;
+
+struct TextSlot
+{
+  std::atomic<bool> taken;
+  uint16_t length;
+  char text[HISTORY_MESSAGE_LEN];
+};
+
+static TextSlot textSlots[APP_TEXT_SLOTS];
+
+void appEventsBegin()
+{
+  appEvents = xQueueCreate(APP_EVENT_QUEUE_LEN, sizeof(AppEvent));
+}
+
+bool postEvent(AppEventType type, int32_t arg)
+{
+  AppEvent event = {type, arg};
+  return xQueueSend(appEvents, &event, 0) == pdTRUE; // Drop rather than stall the producer
+}
+
+bool nextEvent(AppEvent *event)
+{
+  return xQueueReceive(appEvents, event, 0) == pdTRUE;
+}
+
+bool waitEvent(AppEvent *event, uint32_t timeoutUs)
+{
+  TickType_t ticks = (timeoutUs + portTICK_PERIOD_MS * 1000 - 1) / (portTICK_PERIOD_MS * 1000);
+  return xQueueReceive(appEvents, event, ticks) == pdTRUE;
+}
+
+bool postText(AppEventType type, const char *text, size_t length)
+{
+  for (int i = 0; i < APP_TEXT_SLOTS; i++)
+  {
+    TextSlot &slot = textSlots[i];
+    bool expected = false;
+    if (!slot.taken.compare_exchange_strong(expected, true))
+    {
+      continue;
+    }
+    slot.length = length < HISTORY_MESSAGE_LEN - 1 ? length : HISTORY_MESSAGE_LEN - 1;
+    memcpy(slot.text, text, slot.length);
+    if (!postEvent(type, i))
+    {
+      slot.taken = false;
+      return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+const char *eventText(const AppEvent &event, size_t *length)
+{
+  *length = textSlots[event.arg].length;
+  return textSlots[event.arg].text;
+}
+
+void releaseText(const AppEvent &event)
+{
+  textSlots[event.arg].taken = false;
+}
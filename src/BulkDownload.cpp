@@ -0,0 +1,316 @@
+#include "BulkDownload.h"
+#include "BulkTransfer.h"
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "Recorder.h"
+#include "Sessions.h"
+#include "BinLog.h"
+#include <LittleFS.h>
+#include <atomic>
+
+#define BULK_REQUEST_MAX 16 // Largest request payload, OPEN is 8 bytes
+
+struct BulkRequest
+{
+  uint16_t connId;
+  uint8_t length;
+  uint8_t payload[BULK_REQUEST_MAX];
+};
+
+static BLEServer *server = NULL;
+static BLECharacteristic *bulkCharacteristic = NULL;
+static BLEDescriptor *bulkCccd = NULL; // The bulk characteristic's client configuration
+static QueueHandle_t requests = NULL;  // SESSION_MAX slots are only ever taken by disconnects
+
+// Owned by the bulk task
+static File file;
+static BulkSender sender;
+static bool transferring = false;
+static uint16_t owner = 0;     // Connection downloading
+static uint16_t recording = 0;
+static uint32_t filePosition = 0;
+static uint32_t startedMs = 0;
+static uint8_t message[PROTOCOL_MAX_MESSAGE];
+
+// Shared with the BLE task
+static std::atomic<int> inFlight(0);
+static volatile bool congested = false;
+
+// The central asked for bulk notifications on this connection, or had them bonded
+static bool notifying(uint16_t connId)
+{
+  Session *session = sessionFind(connId);
+  return session && session->bulkNotifying;
+}
+
+static bool send(uint16_t connId, size_t payloadLength)
+{
+  if (!notifying(connId))
+  {
+    return false;
+  }
+  size_t length = sealMessage(message, sizeof(message), MSG_BULK, payloadLength);
+  if (length == 0 || esp_ble_gatts_send_indicate(server->getGattsIf(), connId, bulkCharacteristic->getHandle(), length,
+                                                 message, false) != ESP_OK)
+  {
+    return false;
+  }
+  inFlight++;
+  return true;
+}
+
+static void sendError(uint16_t connId, BulkError error, uint8_t op)
+{
+  uint8_t *payload = messagePayload(message);
+  payload[0] = BULK_ERROR;
+  payload[1] = error;
+  send(connId, 2);
+  BINLOG(BULK_ERROR, op, error);
+}
+
+// Largest MSG_BULK payload one notification to this central can carry
+static size_t maxPayload(uint16_t connId)
+{
+  Session *session = sessionFind(connId);
+  uint16_t mtu = session ? session->mtu : 23;
+  size_t capacity = (size_t)(mtu - 3) < sizeof(message) ? (size_t)(mtu - 3) : sizeof(message);
+  return capacity - PROTOCOL_OVERHEAD;
+}
+
+static void endTransfer()
+{
+  if (file)
+  {
+    file.close();
+  }
+  transferring = false;
+}
+
+static void listRecordings(uint16_t connId, const uint8_t *args, size_t length)
+{
+  if (length != 2)
+  {
+    sendError(connId, BULK_ERROR_BAD_REQUEST, BULK_LIST);
+    return;
+  }
+  RecordingEntry entries[BULK_MAX_ENTRIES];
+  int fit = (int)((maxPayload(connId) - 2) / 6);
+  int count = recorderList((uint16_t)getLE(args, 2), entries, fit < BULK_MAX_ENTRIES ? fit : BULK_MAX_ENTRIES);
+  uint8_t *payload = messagePayload(message);
+  payload[0] = BULK_ENTRIES;
+  payload[1] = (uint8_t)count;
+  for (int i = 0; i < count; i++)
+  {
+    putLE(payload + 2 + 6 * i, entries[i].number, 2);
+    putLE(payload + 4 + 6 * i, entries[i].size, 4);
+  }
+  send(connId, 2 + 6 * count);
+}
+
+static void openRecording(uint16_t connId, const uint8_t *args, size_t length)
+{
+  if (length != 7)
+  {
+    sendError(connId, BULK_ERROR_BAD_REQUEST, BULK_OPEN);
+    return;
+  }
+  if (!notifying(connId))
+  {
+    BINLOG(BULK_ERROR, BULK_OPEN, BULK_ERROR_BUSY); // Nowhere to send the chunks, nor the error
+    return;
+  }
+  if (transferring && connId != owner)
+  {
+    sendError(connId, BULK_ERROR_BUSY, BULK_OPEN);
+    return;
+  }
+  endTransfer();
+
+  uint16_t number = (uint16_t)getLE(args, 2);
+  if (recorderWriting(number))
+  {
+    sendError(connId, BULK_ERROR_BUSY, BULK_OPEN); // Its size is still growing, ask again once it is stopped
+    return;
+  }
+  uint32_t offset = (uint32_t)getLE(args + 2, 4);
+  uint8_t window = args[6] == 0 ? BULK_DEFAULT_WINDOW : args[6] > BULK_MAX_WINDOW ? BULK_MAX_WINDOW : args[6];
+  char path[RECORD_PATH_MAX];
+  recordingPath(number, path, sizeof(path));
+  file = LittleFS.open(path, FILE_READ);
+  if (!file)
+  {
+    sendError(connId, BULK_ERROR_NOT_FOUND, BULK_OPEN);
+    return;
+  }
+
+  uint16_t chunk = bulkChunkSize(maxPayload(connId));
+  uint32_t size = file.size();
+  sender.begin(size, offset, window, chunk, millis());
+  owner = connId;
+  recording = number;
+  filePosition = UINT32_MAX; // Seek before the first read
+  startedMs = millis();
+  inFlight = 0;
+  congested = false;
+  transferring = true;
+
+  uint8_t *payload = messagePayload(message);
+  payload[0] = BULK_INFO;
+  putLE(payload + 1, number, 2);
+  putLE(payload + 3, size, 4);
+  putLE(payload + 7, sender.ackedOffset(), 4);
+  putLE(payload + 11, chunk, 2);
+  send(connId, 13);
+  BINLOG(BULK_OPEN, number, sender.ackedOffset(), window, chunk);
+}
+
+static void handleRequest(const BulkRequest &request)
+{
+  const uint8_t *args = request.payload + 1;
+  size_t length = request.length - 1;
+  switch (request.payload[0])
+  {
+  case BULK_LIST:
+    listRecordings(request.connId, args, length);
+    break;
+  case BULK_OPEN:
+    openRecording(request.connId, args, length);
+    break;
+  case BULK_ACK:
+    if (transferring && request.connId == owner && length == 5)
+    {
+      sender.ack((uint32_t)getLE(args, 4), args[4], millis());
+    }
+    break;
+  case BULK_CLOSE:
+    if (transferring && request.connId == owner)
+    {
+      endTransfer();
+    }
+    break;
+  default:
+    sendError(request.connId, BULK_ERROR_BAD_REQUEST, request.payload[0]);
+    break;
+  }
+}
+
+// Keep up to BULK_MAX_IN_FLIGHT chunks queued in the stack while the window allows
+static void pump()
+{
+  uint32_t offset;
+  uint16_t length;
+  uint32_t now = millis();
+  if (!notifying(owner))
+  {
+    endTransfer(); // Notifications turned off, the central asks again to resume
+    return;
+  }
+  while (!congested && inFlight < BULK_MAX_IN_FLIGHT && sender.next(&offset, &length, now))
+  {
+    uint8_t *payload = messagePayload(message);
+    payload[0] = BULK_DATA;
+    putLE(payload + 1, offset, 4);
+    if ((offset != filePosition && !file.seek(offset)) || file.read(payload + BULK_DATA_HEADER, length) != length)
+    {
+      sendError(owner, BULK_ERROR_READ_FAILED, BULK_DATA);
+      endTransfer();
+      return;
+    }
+    filePosition = offset + length;
+    if (!send(owner, BULK_DATA_HEADER + length))
+    {
+      break; // Stack queue full, the same chunk is read again on the next pump
+    }
+    sender.sent(length);
+  }
+  if (sender.done())
+  {
+    BINLOG(BULK_DONE, recording, sender.ackedOffset(), millis() - startedMs, sender.resent());
+    endTransfer();
+  }
+}
+
+static void bulkTask(void *)
+{
+  BulkRequest request;
+  for (;;)
+  {
+    TickType_t wait = transferring ? pdMS_TO_TICKS(BULK_PUMP_MS) : portMAX_DELAY;
+    while (xQueueReceive(requests, &request, wait) == pdTRUE)
+    {
+      handleRequest(request);
+      wait = 0;
+    }
+    if (transferring)
+    {
+      pump();
+    }
+  }
+}
+
+void bulkBegin(BLEServer *s, BLECharacteristic *bulk)
+{
+  server = s;
+  bulkCharacteristic = bulk;
+  bulkCccd = bulk->getDescriptorByUUID(BLEUUID((uint16_t)0x2902));
+  requests = xQueueCreate(BULK_REQUEST_QUEUE + SESSION_MAX, sizeof(BulkRequest));
+  xTaskCreate(bulkTask, "bulk", 4096, NULL, 1, NULL); // Flash reads only stall this task
+}
+
+void bulkWrite(uint16_t connId, const uint8_t *data, size_t length)
+{
+  Message parsed;
+  ProtocolStatus status = parseMessage(data, length, &parsed);
+  if (status != PROTOCOL_OK || parsed.type != MSG_BULK || parsed.length == 0 || parsed.length > BULK_REQUEST_MAX)
+  {
+    BINLOG(BAD_MESSAGE, status, length);
+    return;
+  }
+  BulkRequest request;
+  request.connId = connId;
+  request.length = (uint8_t)parsed.length;
+  memcpy(request.payload, parsed.payload, parsed.length);
+  // A central that floods requests loses the extra ones, but never the room kept for disconnects.
+  // Both run on the BLE task, so nothing takes a slot between the check and the send.
+  if (uxQueueSpacesAvailable(requests) > SESSION_MAX)
+  {
+    xQueueSend(requests, &request, 0);
+  }
+}
+
+// Queued in order, behind the requests this connection made, so none of them outlive it
+void bulkDisconnected(uint16_t connId)
+{
+  BulkRequest request;
+  request.connId = connId;
+  request.length = 1;
+  request.payload[0] = BULK_CLOSE;
+  if (xQueueSend(requests, &request, 0) != pdTRUE)
+  {
+    BINLOG(BULK_ERROR, BULK_CLOSE, BULK_ERROR_BUSY); // Only if the task fell SESSION_MAX disconnects behind
+  }
+}
+
+void bulkGattsEvent(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf, esp_ble_gatts_cb_param_t *param)
+{
+  if (event == ESP_GATTS_WRITE_EVT && bulkCccd != NULL && param->write.handle == bulkCccd->getHandle() &&
+      param->write.len == 2)
+  {
+    Session *session = sessionFind(param->write.conn_id); // Per connection, like the TX characteristic's
+    if (session)
+    {
+      session->bulkNotifying = (param->write.value[0] & 0x01) != 0;
+    }
+  }
+  else if (event == ESP_GATTS_CONF_EVT && bulkCharacteristic != NULL && param->conf.handle == bulkCharacteristic->getHandle())
+  {
+    if (inFlight > 0)
+    {
+      inFlight--;
+    }
+  }
+  else if (event == ESP_GATTS_CONGEST_EVT && transferring && param->congest.conn_id == owner)
+  {
+    congested = param->congest.congested;
+  }
+}
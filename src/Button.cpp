@@ -0,0 +1,116 @@
+#include "Button.h"
+#include "AppEvents.h"
+
+enum ButtonState
+{
+  BUTTON_IDLE,
+  BUTTON_PRESSED,     // First press down, long press not reached yet
+  BUTTON_HELD,        // Long press already reported, waiting for release
+  BUTTON_WAIT_SECOND, // Released once, a second press would make it a double
+  BUTTON_SECOND       // Second press down
+};
+
+static int buttonPin = -1;
+static TaskHandle_t buttonTask = NULL;
+static ButtonState state = BUTTON_IDLE;
+static unsigned long deadline = 0; // Time the current state times out, 0 if it doesn't
+
+static void IRAM_ATTR buttonISR()
+{
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(buttonTask, &woken);
+  if (woken)
+  {
+    portYIELD_FROM_ISR();
+  }
+}
+
+// Advance the press state machine with a debounced level
+static void buttonStep(bool down, unsigned long now)
+{
+  bool expired = deadline != 0 && (long)(now - deadline) >= 0;
+
+  switch (state)
+  {
+  case BUTTON_IDLE:
+    if (down)
+    {
+      state = BUTTON_PRESSED;
+      deadline = now + BUTTON_LONG_MS;
+    }
+    break;
+
+  case BUTTON_PRESSED:
+    if (!down)
+    {
+      state = BUTTON_WAIT_SECOND;
+      deadline = now + BUTTON_DOUBLE_MS;
+    }
+    else if (expired)
+    {
+      postEvent(EVENT_BUTTON_LONG);
+      state = BUTTON_HELD;
+      deadline = 0;
+    }
+    break;
+
+  case BUTTON_HELD:
+    if (!down)
+    {
+      state = BUTTON_IDLE;
+    }
+    break;
+
+  case BUTTON_WAIT_SECOND:
+    if (down)
+    {
+      state = BUTTON_SECOND;
+      deadline = 0;
+    }
+    else if (expired)
+    {
+      postEvent(EVENT_BUTTON_SHORT);
+      state = BUTTON_IDLE;
+      deadline = 0;
+    }
+    break;
+
+  case BUTTON_SECOND:
+    if (!down)
+    {
+      postEvent(EVENT_BUTTON_DOUBLE);
+      state = BUTTON_IDLE;
+    }
+    break;
+  }
+}
+
+static void buttonTaskMain(void *)
+{
+  for (;;)
+  {
+    TickType_t wait = portMAX_DELAY; // Sleep until the next edge when nothing is pending
+    if (deadline != 0)
+    {
+      long remaining = (long)(deadline - millis());
+      wait = remaining > 0 ? pdMS_TO_TICKS(remaining) : 0;
+    }
+
+    if (ulTaskNotifyTake(pdTRUE, wait) > 0)
+    {
+      // Edge seen, wait for the contacts to stop bouncing
+      while (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BUTTON_DEBOUNCE_MS)) > 0)
+      {
+      }
+    }
+    buttonStep(digitalRead(buttonPin) == LOW, millis());
+  }
+}
+
+void buttonBegin(int pin)
+{
+  buttonPin = pin;
+  pinMode(pin, INPUT_PULLUP);
+  xTaskCreate(buttonTaskMain, "button", 2048, NULL, 2, &buttonTask);
+  attachInterrupt(digitalPinToInterrupt(pin), buttonISR, CHANGE);
+}
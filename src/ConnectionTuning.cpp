@@ -0,0 +1,221 @@
+#include "ConnectionTuning.h"
+#include "Sessions.h"
+#include "BinLog.h"
+
+static const ConnectionParams profiles[PROFILE_COUNT] = {
+    {6, 12, 0, 200},   // PROFILE_LOW_LATENCY
+    {24, 40, 0, 400},  // PROFILE_BALANCED
+    {80, 160, 4, 600}, // PROFILE_LOW_POWER
+};
+
+// When each recent central last disconnected, so a returning one gets its own reconnect time
+struct PeerHistory
+{
+  esp_bd_addr_t peer;
+  uint32_t disconnectedAt; // millis(), 0 for an unused entry
+  uint16_t reconnects;
+  bool notifying;     // Bonded and had TX notifications on, its CCCD values survive the reconnect
+  bool bulkNotifying; // and bulk notifications
+};
+
+static PeerHistory peers[CONNECTION_PEER_HISTORY];
+static esp_bd_addr_t dataLengthPeer; // The data length event carries no address, requests go out one per connect
+
+static PeerHistory *findPeer(const esp_bd_addr_t peer)
+{
+  for (int i = 0; i < CONNECTION_PEER_HISTORY; i++)
+  {
+    if (peers[i].disconnectedAt != 0 && memcmp(peers[i].peer, peer, sizeof(esp_bd_addr_t)) == 0)
+    {
+      return &peers[i];
+    }
+  }
+  return NULL;
+}
+
+// The session of a central, NULL once it disconnected
+static ConnectionInfo *findInfo(const esp_bd_addr_t peer)
+{
+  Session *session = sessionFindPeer(peer);
+  return session ? &session->connection : NULL;
+}
+
+// Runs on the Bluetooth task after the BLE library has seen the event
+static void gapEvents(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param)
+{
+  ConnectionInfo *info;
+  switch (event)
+  {
+  case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+    info = findInfo(param->update_conn_params.bda);
+    if (info && param->update_conn_params.status == ESP_BT_STATUS_SUCCESS)
+    {
+      info->interval = param->update_conn_params.conn_int;
+      info->latency = param->update_conn_params.latency;
+      info->timeout = param->update_conn_params.timeout;
+    }
+    BINLOG(CONN_PARAMS, param->update_conn_params.status, param->update_conn_params.conn_int,
+           param->update_conn_params.latency, param->update_conn_params.timeout);
+    break;
+  case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+    info = findInfo(dataLengthPeer);
+    if (info && param->pkt_data_lenth_cmpl.status == ESP_BT_STATUS_SUCCESS)
+    {
+      info->txOctets = param->pkt_data_lenth_cmpl.params.tx_len;
+      info->rxOctets = param->pkt_data_lenth_cmpl.params.rx_len;
+    }
+    BINLOG(CONN_DATA_LENGTH, param->pkt_data_lenth_cmpl.status, param->pkt_data_lenth_cmpl.params.tx_len,
+           param->pkt_data_lenth_cmpl.params.rx_len);
+    break;
+  case ESP_GAP_BLE_AUTH_CMPL_EVT:
+  {
+    Session *session = sessionFindPeer(param->ble_security.auth_cmpl.bd_addr);
+    if (session)
+    {
+      info = &session->connection;
+      info->encrypted = param->ble_security.auth_cmpl.success;
+      info->securedMs = (uint16_t)min(millis() - info->connectedAt, 65535UL);
+      BINLOG(CONN_SECURED, info->encrypted, info->securedMs, param->ble_security.auth_cmpl.fail_reason);
+
+      // A bonded central keeps its CCCD value across connections and need not write it again.
+      // Only restored once its keys check out, not for any central using the same address.
+      PeerHistory *history = findPeer(param->ble_security.auth_cmpl.bd_addr);
+      if (info->encrypted && history)
+      {
+        session->notifying = session->notifying || history->notifying;
+        session->bulkNotifying = session->bulkNotifying || history->bulkNotifying;
+      }
+    }
+    break;
+  }
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+  case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+    info = findInfo(param->phy_update.bda);
+    if (info && param->phy_update.status == ESP_BT_STATUS_SUCCESS)
+    {
+      info->txPhy = param->phy_update.tx_phy;
+      info->rxPhy = param->phy_update.rx_phy;
+    }
+    BINLOG(CONN_PHY, param->phy_update.status, param->phy_update.tx_phy, param->phy_update.rx_phy);
+    break;
+#endif
+  default:
+    break;
+  }
+}
+
+void connectionTuningBegin()
+{
+  BLEDevice::setMTU(CONNECTION_MTU);
+  BLEDevice::setCustomGapHandler(gapEvents);
+
+  // Ask every central for an encrypted, bonded link. No display or keyboard, so "just works".
+  BLEDevice::setEncryptionLevel(ESP_BLE_SEC_ENCRYPT);
+  BLESecurity *security = new BLESecurity();
+  security->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_BOND);
+  security->setCapability(ESP_IO_CAP_NONE);
+  security->setInitEncryptionKey(ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK);
+  security->setRespEncryptionKey(ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK);
+}
+
+// Link level values start over on every connection, the reconnect history comes from the peer table
+void connectionTuningConnected(const esp_bd_addr_t peer, ConnectionInfo &info, ConnectionProfile profile)
+{
+  memset(&info, 0, sizeof(info));
+  info.txOctets = 27;
+  info.rxOctets = 27;
+  info.mtu = 23;
+  info.txPhy = 1;
+  info.rxPhy = 1;
+  info.connectedAt = millis();
+  PeerHistory *history = findPeer(peer);
+  if (history)
+  {
+    info.reconnectMs = info.connectedAt - history->disconnectedAt;
+    info.reconnects = ++history->reconnects;
+    BINLOG(RECONNECTED, info.reconnectMs);
+  }
+
+  esp_bd_addr_t peerAddress;
+  memcpy(peerAddress, peer, sizeof(esp_bd_addr_t));
+  memcpy(dataLengthPeer, peer, sizeof(esp_bd_addr_t));
+  esp_ble_gap_set_pkt_data_len(peerAddress, CONNECTION_DATA_LENGTH);
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+  // The classic ESP32 controller is BLE 4.2, only newer chips can switch PHY
+  esp_ble_gap_set_prefered_phy(peerAddress, 0, ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                               ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
+  connectionRequestProfile(peer, info, profile);
+}
+
+bool connectionRequestProfile(const esp_bd_addr_t peer, ConnectionInfo &info, ConnectionProfile profile)
+{
+  if (profile >= PROFILE_COUNT)
+  {
+    return false;
+  }
+  const ConnectionParams &p = profiles[profile];
+  esp_ble_conn_update_params_t params;
+  memcpy(params.bda, peer, sizeof(esp_bd_addr_t));
+  params.min_int = p.minInterval;
+  params.max_int = p.maxInterval;
+  params.latency = p.latency;
+  params.timeout = p.timeout;
+  info.requested = profile;
+  return esp_ble_gap_update_conn_params(&params) == ESP_OK;
+}
+
+// Remembered for the central's next connect, the oldest entry makes room
+void connectionTuningDisconnected(const esp_bd_addr_t peer, const Session *session)
+{
+  PeerHistory *history = findPeer(peer);
+  if (!history)
+  {
+    history = &peers[0];
+    for (int i = 1; i < CONNECTION_PEER_HISTORY; i++)
+    {
+      if (peers[i].disconnectedAt < history->disconnectedAt)
+      {
+        history = &peers[i];
+      }
+    }
+    memcpy(history->peer, peer, sizeof(esp_bd_addr_t));
+    history->reconnects = 0;
+  }
+  history->disconnectedAt = max(millis(), 1UL); // 0 marks a free entry
+  bool bonded = session && session->connection.encrypted;
+  history->notifying = bonded && session->notifying;
+  history->bulkNotifying = bonded && session->bulkNotifying;
+}
+
+const ConnectionParams &connectionParams(ConnectionProfile profile)
+{
+  return profiles[profile];
+}
+
+size_t serializeConnectionInfo(const ConnectionInfo &info, uint8_t *out, size_t capacity)
+{
+  if (capacity < CONNECTION_INFO_WIRE_SIZE)
+  {
+    return 0;
+  }
+  const uint16_t fields[] = {info.interval, info.latency, info.timeout, info.txOctets, info.rxOctets, info.mtu};
+  out[0] = info.requested;
+  for (int i = 0; i < 6; i++)
+  {
+    out[1 + 2 * i] = (uint8_t)fields[i];
+    out[2 + 2 * i] = (uint8_t)(fields[i] >> 8);
+  }
+  out[13] = info.txPhy;
+  out[14] = info.rxPhy;
+  out[15] = info.encrypted;
+  for (int i = 0; i < 4; i++)
+  {
+    out[16 + i] = (uint8_t)(info.reconnectMs >> (8 * i));
+  }
+  out[20] = (uint8_t)info.securedMs;
+  out[21] = (uint8_t)(info.securedMs >> 8);
+  out[22] = (uint8_t)info.reconnects;
+  out[23] = (uint8_t)(info.reconnects >> 8);
+  return CONNECTION_INFO_WIRE_SIZE;
+}
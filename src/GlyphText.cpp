@@ -0,0 +1,87 @@
+#include "GlyphText.h"
+#include "GlyphAtlas.h"
+#include "Utf8.h"
+
+static uint16_t glyphPixels[GLYPH_MAX_CELL_PIXELS]; // The largest cell expanded to RGB565
+
+static const GlyphSet &glyphSet(int textSize)
+{
+  return glyphSets[constrain(textSize, 1, GLYPH_SIZES) - 1];
+}
+
+// Binary search of the sorted codepoint table, -1 when the atlas lacks the glyph
+static int glyphIndex(uint32_t codepoint)
+{
+  int low = 0;
+  int high = GLYPH_COUNT - 1;
+  while (low <= high)
+  {
+    int mid = (low + high) / 2;
+    uint32_t value = glyphCodepoints[mid];
+    if (value == codepoint)
+    {
+      return mid;
+    }
+    if (value < codepoint)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid - 1;
+    }
+  }
+  return -1;
+}
+
+int glyphWidth(int textSize)
+{
+  return glyphSet(textSize).width;
+}
+
+int glyphHeight(int textSize)
+{
+  return glyphSet(textSize).height;
+}
+
+void drawGlyph(TFT_eSPI &tft, uint32_t codepoint, int x, int y, int textSize, uint16_t textColor, uint16_t bgColor)
+{
+  const GlyphSet &set = glyphSet(textSize);
+  int index = glyphIndex(codepoint);
+  if (index < 0)
+  {
+    index = glyphIndex('?');
+  }
+  if (index < 0)
+  {
+    // An atlas generated without '?' has nothing to stand in, leave the cell blank
+    tft.fillRect(x, y, set.width, set.height, bgColor);
+    return;
+  }
+
+  // Expand the 1 bit cell into the blit buffer and send it as one window
+  const uint8_t *bitmap = set.bitmaps + index * set.stride * set.height;
+  uint16_t *pixel = glyphPixels;
+  for (int row = 0; row < set.height; row++)
+  {
+    const uint8_t *bits = bitmap + row * set.stride;
+    for (int col = 0; col < set.width; col++)
+    {
+      *pixel++ = (bits[col >> 3] & (0x80 >> (col & 7))) ? textColor : bgColor;
+    }
+  }
+  tft.pushImage(x, y, set.width, set.height, glyphPixels);
+}
+
+int drawGlyphRun(TFT_eSPI &tft, const char *text, int length, int x, int y, int textSize, uint16_t textColor,
+                 uint16_t bgColor)
+{
+  const char *end = text + length;
+  int advance = glyphWidth(textSize);
+  while (text < end)
+  {
+    drawGlyph(tft, utf8Next(text, end), x, y, textSize, textColor, bgColor);
+    x += advance;
+  }
+  return x;
+}
@@ -0,0 +1,162 @@
+#include "HistoryView.h"
+#include "GlyphText.h"
+
+// ST7789 on the T-Display: 240x320 frame memory, the visible 135x240 window starts at row 40
+#define ST7789_VSCRDEF 0x33  // Vertical scrolling definition
+#define ST7789_VSCRSADD 0x37 // Vertical scroll start address
+#define ST7789_NORON 0x13    // Normal display mode, ends scrolling
+#define PANEL_ROW_OFFSET 40
+#define PANEL_MEMORY_ROWS 320
+
+#define SCREEN_ROWS 240                               // Scroll area height in portrait
+#define VISIBLE_LINES (SCREEN_ROWS / HISTORY_LINE_HEIGHT)
+#define TEXT_MARGIN 4
+
+static int wrapRow(int y)
+{
+  return ((y % SCREEN_ROWS) + SCREEN_ROWS) % SCREEN_ROWS;
+}
+
+HistoryView::HistoryView(TFT_eSPI &display, const MessageHistory &messages)
+    : tft(display), history(messages), offset(0), targetOffset(0), scroll(0), progress(0), forward(true), lastStep(0)
+{
+}
+
+int HistoryView::columns() const
+{
+  return (135 - 2 * TEXT_MARGIN) / glyphWidth(1);
+}
+
+void HistoryView::begin()
+{
+  tft.setRotation(0); // Hardware scrolling runs along the panel's native rows
+  tft.fillScreen(TFT_BLACK);
+  // Scroll area covers exactly the visible window
+  tft.writecommand(ST7789_VSCRDEF);
+  tft.writedata(PANEL_ROW_OFFSET >> 8);
+  tft.writedata(PANEL_ROW_OFFSET & 0xFF);
+  tft.writedata(SCREEN_ROWS >> 8);
+  tft.writedata(SCREEN_ROWS & 0xFF);
+  tft.writedata((PANEL_MEMORY_ROWS - PANEL_ROW_OFFSET - SCREEN_ROWS) >> 8);
+  tft.writedata((PANEL_MEMORY_ROWS - PANEL_ROW_OFFSET - SCREEN_ROWS) & 0xFF);
+
+  offset = 0;
+  targetOffset = 0;
+  scroll = 0;
+  progress = 0;
+  setScrollStart(0);
+
+  // Initial page is the only full draw, everything after that scrolls
+  for (int row = 0; row < VISIBLE_LINES; row++)
+  {
+    int y = row * HISTORY_LINE_HEIGHT;
+    drawLine(VISIBLE_LINES - 1 - row, y, y, HISTORY_LINE_HEIGHT);
+  }
+}
+
+void HistoryView::end()
+{
+  setScrollStart(0);
+  tft.writecommand(ST7789_NORON);
+  tft.setRotation(1); // Back to the landscape layout used by the other views
+  tft.fillScreen(TFT_BLACK);
+}
+
+bool HistoryView::pageBack()
+{
+  int oldest = history.lineCount(columns()) - VISIBLE_LINES;
+  if (oldest < 0)
+  {
+    oldest = 0;
+  }
+  if (targetOffset >= oldest)
+  {
+    return false;
+  }
+  targetOffset = min(targetOffset + VISIBLE_LINES, oldest);
+  return true;
+}
+
+void HistoryView::messageAdded()
+{
+  int lines = history.linesFor(0, columns());
+
+  // The new lines are below the screen now, so the view is that much further from the bottom
+  offset += lines;
+  if (targetOffset != 0)
+  {
+    targetOffset += lines; // Reading older messages, keep them in place
+  }
+}
+
+void HistoryView::update()
+{
+  if (offset == targetOffset && progress == 0)
+  {
+    return;
+  }
+  if ((millis() - lastStep) < HISTORY_STEP_MS)
+  {
+    return;
+  }
+  lastStep = millis();
+
+  if (progress == 0)
+  {
+    forward = targetOffset < offset; // A line that started moving finishes in the same direction
+  }
+
+  if (forward)
+  {
+    // Content moves up, the next newer line is revealed at the bottom.
+    // Its slot starts where the top of the screen was before this line started moving.
+    drawLine(offset - 1, wrapRow(scroll - progress), scroll, HISTORY_SCROLL_STEP);
+    scroll = wrapRow(scroll + HISTORY_SCROLL_STEP);
+    progress += HISTORY_SCROLL_STEP;
+    if (progress >= HISTORY_LINE_HEIGHT)
+    {
+      progress = 0;
+      offset--;
+    }
+  }
+  else
+  {
+    // Content moves down, the next older line is revealed at the top
+    drawLine(offset + VISIBLE_LINES, wrapRow(scroll + progress - HISTORY_LINE_HEIGHT),
+             wrapRow(scroll - HISTORY_SCROLL_STEP), HISTORY_SCROLL_STEP);
+    scroll = wrapRow(scroll - HISTORY_SCROLL_STEP);
+    progress += HISTORY_SCROLL_STEP;
+    if (progress >= HISTORY_LINE_HEIGHT)
+    {
+      progress = 0;
+      offset++;
+    }
+  }
+  setScrollStart(scroll);
+}
+
+// Draw the part of a text line that falls inside a strip of frame memory rows.
+// Lines are counted from the newest one upwards, lines that do not exist are left blank.
+void HistoryView::drawLine(int fromBottom, int lineY, int stripY, int stripHeight)
+{
+  int width = tft.width();
+  tft.setViewport(0, stripY, width, stripHeight, false); // Clip drawing to the strip
+  tft.fillRect(0, stripY, width, stripHeight, TFT_BLACK);
+
+  const char *text;
+  int length;
+  int index = history.lineCount(columns()) - 1 - fromBottom;
+  if (index >= 0 && history.line(index, columns(), &text, &length))
+  {
+    drawGlyphRun(tft, text, length, TEXT_MARGIN, lineY, 1, TFT_WHITE, TFT_BLACK);
+  }
+  tft.resetViewport();
+}
+
+void HistoryView::setScrollStart(int offset)
+{
+  int address = PANEL_ROW_OFFSET + offset;
+  tft.writecommand(ST7789_VSCRSADD);
+  tft.writedata(address >> 8);
+  tft.writedata(address & 0xFF);
+}
@@ -0,0 +1,280 @@
+#include "Recorder.h"
+#include "RecordFormat.h"
+#include "BinLog.h"
+#include <LittleFS.h>
+#include <atomic>
+
+enum RecorderJobType : uint8_t
+{
+  JOB_OPEN,  // Create the file for recording `number`
+  JOB_WRITE, // Append `buffer`, then hand it back
+  JOB_CLOSE
+};
+
+struct RecorderJob
+{
+  RecorderJobType type;
+  uint8_t buffer;
+  uint16_t number;
+};
+
+static uint8_t buffers[2][RECORD_SEGMENT_SIZE];
+static volatile bool busy[2] = {false, false}; // Owned by the writer task until it is on flash
+static int active = 0;                         // Buffer loop() is filling
+static SegmentWriter segment;
+static uint32_t segmentSequence = 0;
+
+static QueueHandle_t jobs = NULL;
+static bool mounted = false;
+static bool recording = false;
+static volatile bool failed = false; // Set by the writer when the flash is full or gone
+static uint16_t nextNumber = 1;
+static uint16_t currentNumber = 0;
+static std::atomic<uint16_t> writingNumber(0); // Recording with its file open for writing, 0 when none
+
+// frames and dropped are counted by loop(), segments and errors by the writer task
+static std::atomic<uint32_t> frameCount(0);
+static std::atomic<uint32_t> segmentCount(0);
+static std::atomic<uint32_t> droppedCount(0);
+static std::atomic<uint32_t> errorCount(0);
+
+// Closes the file and lets downloads have it, on JOB_CLOSE or as soon as the flash fails
+static void closeFile(File &file, uint16_t number)
+{
+  if (file)
+  {
+    file.close();
+  }
+  writingNumber.compare_exchange_strong(number, 0); // A quick restart may already be writing the next one
+}
+
+// The flash failed, nothing more of this recording gets written. loop() sees `failed` and stops it.
+static void writeFailed(File &file, uint16_t number)
+{
+  errorCount++;
+  failed = true;
+  BINLOG(RECORD_ERROR, number);
+  closeFile(file, number);
+}
+
+static void writerTask(void *)
+{
+  File file;
+  RecorderJob job;
+  for (;;)
+  {
+    xQueueReceive(jobs, &job, portMAX_DELAY);
+    switch (job.type)
+    {
+    case JOB_OPEN:
+    {
+      char path[RECORD_PATH_MAX];
+      recordingPath(job.number, path, sizeof(path));
+      file = LittleFS.open(path, FILE_WRITE);
+      if (!file)
+      {
+        writeFailed(file, job.number);
+      }
+      break;
+    }
+    case JOB_WRITE:
+      if (file && !failed)
+      {
+        // Flushed per segment so a power cut loses at most the segment being filled
+        if (file.write(buffers[job.buffer], RECORD_SEGMENT_SIZE) == RECORD_SEGMENT_SIZE)
+        {
+          file.flush();
+          segmentCount++;
+        }
+        else
+        {
+          writeFailed(file, job.number);
+        }
+      }
+      busy[job.buffer] = false;
+      break;
+    case JOB_CLOSE:
+      closeFile(file, job.number);
+      BINLOG(RECORD_STOP, job.number, frameCount.load(), segmentCount.load(), droppedCount.load());
+      break;
+    }
+  }
+}
+
+void recordingPath(uint16_t number, char *path, size_t capacity)
+{
+  snprintf(path, capacity, RECORD_DIR "/%05u.rec", number);
+}
+
+static uint16_t recordingNumber(File &entry)
+{
+  const char *name = strrchr(entry.name(), '/'); // Older cores return the full path
+  return (uint16_t)atoi(name ? name + 1 : entry.name());
+}
+
+// Highest recording number already on flash, so a reboot never overwrites one
+static uint16_t lastRecordingNumber()
+{
+  uint16_t highest = 0;
+  File dir = LittleFS.open(RECORD_DIR);
+  if (!dir || !dir.isDirectory())
+  {
+    return 0;
+  }
+  for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile())
+  {
+    uint16_t number = recordingNumber(entry);
+    if (number > highest)
+    {
+      highest = number;
+    }
+  }
+  return highest;
+}
+
+int recorderList(uint16_t after, RecordingEntry *entries, int max)
+{
+  int count = 0;
+  File dir = LittleFS.open(RECORD_DIR);
+  if (!mounted || !dir || !dir.isDirectory())
+  {
+    return 0;
+  }
+  for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile())
+  {
+    uint16_t number = recordingNumber(entry);
+    if (number <= after || (count == max && number > entries[max - 1].number))
+    {
+      continue;
+    }
+    // Insertion sort, keeping the lowest numbers when there are more than fit
+    int i = count < max ? count++ : max - 1;
+    for (; i > 0 && entries[i - 1].number > number; i--)
+    {
+      entries[i] = entries[i - 1];
+    }
+    entries[i].number = number;
+    entries[i].size = entry.size();
+  }
+  return count;
+}
+
+bool recorderBegin()
+{
+  mounted = LittleFS.begin(true); // Format on the first boot
+  if (!mounted)
+  {
+    BINLOG(RECORD_ERROR, 0);
+    return false;
+  }
+  LittleFS.mkdir(RECORD_DIR);
+  nextNumber = lastRecordingNumber() + 1;
+  jobs = xQueueCreate(RECORD_QUEUE_DEPTH, sizeof(RecorderJob));
+  xTaskCreate(writerTask, "recorder", 4096, NULL, 1, NULL); // Flash waits only stall this task
+  return true;
+}
+
+static void sendJob(RecorderJobType type, uint8_t buffer)
+{
+  RecorderJob job = {type, buffer, currentNumber};
+  xQueueSend(jobs, &job, 0); // Deep enough for every job one recording can have outstanding
+}
+
+// Seal the current segment, queue it and carry on in the other buffer
+static bool handOff()
+{
+  int next = active ^ 1;
+  if (busy[next])
+  {
+    return false; // Flash still busy with the segment before
+  }
+  segment.seal();
+  busy[active] = true;
+  sendJob(JOB_WRITE, active);
+  active = next;
+  segment.begin(buffers[active], ++segmentSequence);
+  return true;
+}
+
+bool recorderStart()
+{
+  if (!mounted || recording)
+  {
+    return false;
+  }
+  // A quick stop and start may still have the last segment on its way to flash
+  active = busy[0] ? 1 : 0;
+  if (busy[active])
+  {
+    return false;
+  }
+  frameCount = 0;
+  segmentCount = 0;
+  droppedCount = 0;
+  errorCount = 0;
+  failed = false;
+  currentNumber = nextNumber++;
+  writingNumber = currentNumber; // Until the writer has closed the file
+  segmentSequence = 0;
+  segment.begin(buffers[active], segmentSequence);
+  sendJob(JOB_OPEN, 0);
+  recording = true;
+  BINLOG(RECORD_START, currentNumber);
+  return true;
+}
+
+void recorderStop()
+{
+  if (!recording)
+  {
+    return;
+  }
+  recording = false;
+  if (segment.frameCount() > 0)
+  {
+    segment.seal();
+    busy[active] = true;
+    sendJob(JOB_WRITE, active);
+  }
+  sendJob(JOB_CLOSE, 0);
+}
+
+bool recorderActive()
+{
+  return recording && !failed;
+}
+
+bool recorderRecording()
+{
+  return recording;
+}
+
+bool recorderFailed()
+{
+  return recording && failed;
+}
+
+bool recorderWriting(uint16_t number)
+{
+  return number != 0 && number == writingNumber;
+}
+
+void recorderAdd(const int16_t *values, uint32_t captureUs)
+{
+  if (!recording || failed)
+  {
+    return;
+  }
+  if (!segment.add(values, captureUs) && !(handOff() && segment.add(values, captureUs)))
+  {
+    droppedCount++;
+    return;
+  }
+  frameCount++;
+}
+
+RecorderStats recorderStats()
+{
+  RecorderStats stats = {frameCount, segmentCount, droppedCount, errorCount};
+  return stats;
+}
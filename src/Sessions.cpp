@@ -0,0 +1,389 @@
+#include "Sessions.h"
+#include "BinLog.h"
+#include "StageProfiler.h"
+
+Session sessions[SESSION_MAX];
+
+static BLEServer *server = NULL;
+static BLECharacteristic *txCharacteristic = NULL;
+static BLEDescriptor *cccd = NULL; // The TX characteristic's client configuration
+static uint16_t frameSequence = 0; // Per frame published, receivers at lower rates see regular gaps
+static bool codedAllowed = false;  // Coding every session's frames fits SESSION_CODED_BUDGET
+
+// The newest frame, encoded and sealed once per format. Single frame notifications send it as is,
+// batching sessions copy its payload.
+static uint8_t frameMessage[PROTOCOL_OVERHEAD + FRAME_PAYLOAD_SIZE];
+static uint8_t packedMessage[PROTOCOL_OVERHEAD + PACKED_FRAME_SIZE];
+static_assert(PACKED_FRAME_SIZE <= FRAME_PAYLOAD_SIZE, "Session::batch holds batches of either format");
+
+// A coded session's batch, compressed when it is sent. One buffer serves every session, loop() sends them in turn.
+static uint8_t codedMessage[PROTOCOL_OVERHEAD + CODEC_MAX_BLOCK(PACER_MAX_BATCH)];
+
+static size_t frameSize(const Session &session)
+{
+  return session.batchFormat == BATCH_PACKED ? PACKED_FRAME_SIZE : FRAME_PAYLOAD_SIZE;
+}
+
+static size_t maxMessage(const Session &session)
+{
+  return session.mtu - 3; // ATT notification header
+}
+
+// Frames of the session's format that fit one notification, a coded batch even when it doesn't compress
+static size_t framesFit(const Session &session)
+{
+  size_t header = PROTOCOL_OVERHEAD + (session.batchFormat == BATCH_CODED ? CODEC_HEADER_SIZE : 0);
+  return maxMessage(session) < header ? 0 : (maxMessage(session) - header) / frameSize(session);
+}
+
+static void limitBatch(Session &session)
+{
+  size_t fit = framesFit(session);
+  if (fit == 0)
+  {
+    BINLOG(FRAMES_REFUSED, session.connId, session.mtu);
+  }
+  session.pacer.setMaxBatch(fit);
+  session.batchMtu = session.mtu;
+}
+
+// Cycles sendCoded() spends per frame, in batches of one (the costliest, a key block every
+// CODEC_KEY_INTERVAL) on noisy frames that keep missing their prediction
+static uint32_t measureCodedCycles()
+{
+  static FrameEncoder encoder; // Too big for setup()'s stack on the larger gloves
+  CodecFrame frame = {};
+  uint8_t payload[FRAME_PAYLOAD_SIZE];
+  uint32_t noise = 0x9E3779B9;
+  uint32_t cycles = 0;
+  for (int f = 0; f < 2 * CODEC_KEY_INTERVAL; f++)
+  {
+    for (int i = 0; i < FRAME_VALUES; i++)
+    {
+      noise ^= noise << 13; // xorshift32
+      noise ^= noise >> 17;
+      noise ^= noise << 5;
+      frame.values[i] = (int16_t)(i < FLEX_COUNT ? noise % 91 : (int32_t)(noise % 2001) - 1000);
+    }
+    frame.sequence = (uint16_t)f;
+    frame.captureUs = f * 2000 + noise % 64;
+    encodeFrame(frame.values, frame.sequence, frame.captureUs, payload);
+
+    uint32_t start = profileTicks();
+    CodecFrame decoded;
+    decodeFrame(payload, FRAME_PAYLOAD_SIZE, decoded.values, &decoded.sequence, &decoded.captureUs);
+    encoder.encode(&decoded, 1, messagePayload(codedMessage), sizeof(codedMessage) - PROTOCOL_OVERHEAD);
+    cycles += profileTicks() - start;
+  }
+  return cycles / (2 * CODEC_KEY_INTERVAL);
+}
+
+void sessionsBegin(BLEServer *s, BLECharacteristic *tx, uint32_t frameIntervalUs)
+{
+  server = s;
+  txCharacteristic = tx;
+  cccd = tx->getDescriptorByUUID(BLEUUID((uint16_t)0x2902));
+
+  uint32_t cycles = measureCodedCycles();
+  uint32_t budget = frameIntervalUs * profileTicksPerUs() / 100 * SESSION_CODED_BUDGET / SESSION_MAX;
+  codedAllowed = cycles <= budget;
+  BINLOG(CODED_BUDGET, cycles, budget);
+  if (!codedAllowed)
+  {
+    BINLOG(CODED_OFF, cycles, budget);
+  }
+}
+
+Session *sessionOpen(uint16_t connId, const esp_bd_addr_t peer)
+{
+  for (int i = 0; i < SESSION_MAX; i++)
+  {
+    Session &session = sessions[i];
+    if (session.state == SESSION_FREE)
+    {
+      session.connId = connId;
+      memcpy(session.peer, peer, sizeof(esp_bd_addr_t));
+      session.mtu = 23; // Default ATT MTU until the exchange
+      session.notifying = false;
+      session.bulkNotifying = false;
+      session.streams = STREAM_RAW;
+      session.intervalMs = SESSION_DEFAULT_INTERVAL;
+      session.state = SESSION_OPENING; // Last, loop() starts it from here
+      return &session;
+    }
+  }
+  return NULL;
+}
+
+void sessionClose(uint16_t connId)
+{
+  Session *session = sessionFind(connId);
+  if (session)
+  {
+    session->state = SESSION_CLOSING;
+  }
+}
+
+static bool connected(const Session &session)
+{
+  uint8_t state = session.state;
+  return state == SESSION_OPENING || state == SESSION_ACTIVE;
+}
+
+Session *sessionFind(uint16_t connId)
+{
+  for (int i = 0; i < SESSION_MAX; i++)
+  {
+    if (connected(sessions[i]) && sessions[i].connId == connId)
+    {
+      return &sessions[i];
+    }
+  }
+  return NULL;
+}
+
+Session *sessionFindPeer(const esp_bd_addr_t peer)
+{
+  for (int i = 0; i < SESSION_MAX; i++)
+  {
+    if (connected(sessions[i]) && memcmp(sessions[i].peer, peer, sizeof(esp_bd_addr_t)) == 0)
+    {
+      return &sessions[i];
+    }
+  }
+  return NULL;
+}
+
+int sessionCount()
+{
+  int count = 0;
+  for (int i = 0; i < SESSION_MAX; i++)
+  {
+    count += connected(sessions[i]);
+  }
+  return count;
+}
+
+// Only recorded here, loop() limits the batch size when it next sends to the session
+void sessionMtuChanged(uint16_t connId, uint16_t mtu)
+{
+  Session *session = sessionFind(connId);
+  if (session)
+  {
+    session->mtu = mtu;
+    session->connection.mtu = mtu;
+  }
+}
+
+void sessionsUpdate()
+{
+  for (int i = 0; i < SESSION_MAX; i++)
+  {
+    Session &session = sessions[i];
+    uint8_t state = session.state;
+    if (state == SESSION_OPENING)
+    {
+      session.lastFrameMs = millis();
+      session.lastStatsMs = millis();
+      session.pacer.reset(millis());
+      session.batched = 0;
+      session.batchFormat = BATCH_FRAME;
+      session.batchMtu = 0; // Limited on the first frame
+      session.encoder.reset();
+      session.state.compare_exchange_strong(state, SESSION_ACTIVE); // Unless it closed meanwhile
+    }
+    else if (state == SESSION_CLOSING)
+    {
+      session.state = SESSION_FREE;
+    }
+  }
+}
+
+static bool send(Session &session, uint8_t *message, size_t length)
+{
+  if (!session.notifying || length > maxMessage(session))
+  {
+    return false; // Not asked for, or the stack would cut it short
+  }
+  esp_err_t result = esp_ble_gatts_send_indicate(server->getGattsIf(), session.connId, txCharacteristic->getHandle(),
+                                                 length, message, false);
+  session.pacer.submitted(length);
+  if (result != ESP_OK)
+  {
+    session.pacer.completed(false); // Never reached the stack, no completion event will follow
+    return false;
+  }
+  return true;
+}
+
+bool sessionNotify(Session &session, uint8_t *buffer, size_t capacity, MessageType type, size_t payloadLength)
+{
+  size_t length = sealMessage(buffer, capacity, type, payloadLength);
+  return length > 0 && send(session, buffer, length);
+}
+
+void sessionsNotify(uint8_t streams, uint8_t *buffer, size_t capacity, MessageType type, size_t payloadLength)
+{
+  size_t length = sealMessage(buffer, capacity, type, payloadLength);
+  for (int i = 0; i < SESSION_MAX && length > 0; i++)
+  {
+    if (sessions[i].state == SESSION_ACTIVE && (sessions[i].streams & streams))
+    {
+      send(sessions[i], buffer, length);
+    }
+  }
+}
+
+// The batch as one coded block. A block that doesn't reach the stack breaks the chain of the ones
+// after it, so the next one starts over as a key block.
+static void sendCoded(Session &session)
+{
+  CodecFrame frames[PACER_MAX_BATCH];
+  const uint8_t *payloads = messagePayload(session.batch);
+  for (int i = 0; i < session.batched; i++)
+  {
+    decodeFrame(payloads + i * FRAME_PAYLOAD_SIZE, FRAME_PAYLOAD_SIZE, frames[i].values, &frames[i].sequence,
+                &frames[i].captureUs);
+  }
+  size_t length = session.encoder.encode(frames, session.batched, messagePayload(codedMessage),
+                                         sizeof(codedMessage) - PROTOCOL_OVERHEAD);
+  if (!sessionNotify(session, codedMessage, sizeof(codedMessage), MSG_CODED_FRAMES, length))
+  {
+    session.encoder.reset();
+  }
+}
+
+// Queue the newest frame for one session and send its batch when it is full
+static void offerFrame(Session &session, uint32_t now, BatchFormat format)
+{
+  NotifyPacer &pacer = session.pacer;
+  if (pacer.update(now))
+  {
+    BINLOG(PACING, session.connId, pacer.batchSize(), pacer.decimation(), pacer.linkStats().throughputBps);
+  }
+  if (!pacer.takeFrame())
+  {
+    return; // Decimated while this link can't keep up with every frame
+  }
+
+  // The format switches here between batches, after a SUBSCRIBE or an MTU exchange
+  if (format != session.batchFormat)
+  {
+    session.batched = 0; // Frames of the old format are not sent
+    session.batchFormat = format;
+    session.encoder.reset();
+    limitBatch(session);
+  }
+  else if (session.mtu != session.batchMtu)
+  {
+    limitBatch(session);
+  }
+  if (framesFit(session) == 0)
+  {
+    return; // Held back until the MTU exchange makes room
+  }
+  bool packed = format == BATCH_PACKED;
+  uint8_t *message = packed ? packedMessage : frameMessage;
+  size_t messageSize = packed ? sizeof(packedMessage) : sizeof(frameMessage);
+  size_t size = frameSize(session);
+
+  // Common case, nothing waiting and no batching: the shared message goes out untouched
+  if (session.batched == 0 && pacer.batchSize() == 1 && pacer.canSubmit() && format != BATCH_CODED)
+  {
+    send(session, message, messageSize);
+    return;
+  }
+
+  uint8_t *frames = messagePayload(session.batch);
+  if (session.batched >= pacer.maxBatchSize())
+  {
+    // Link stalled with a full batch, the oldest frame makes room
+    memmove(frames, frames + size, (session.batched - 1) * size);
+    session.batched--;
+    pacer.frameDropped();
+  }
+  memcpy(frames + session.batched * size, messagePayload(message), size);
+  session.batched++;
+
+  if (session.batched >= pacer.batchSize() && pacer.canSubmit())
+  {
+    if (format == BATCH_CODED)
+    {
+      sendCoded(session);
+    }
+    else
+    {
+      sessionNotify(session, session.batch, sizeof(session.batch), packed ? MSG_PACKED_FRAME : MSG_FRAME,
+                    session.batched * size);
+    }
+    session.batched = 0;
+  }
+}
+
+void sessionsPublishFrame(const int16_t *values, uint32_t captureUs)
+{
+  uint32_t now = millis();
+  bool encoded = false;
+  bool packedEncoded = false;
+  for (int i = 0; i < SESSION_MAX; i++)
+  {
+    Session &session = sessions[i];
+    uint8_t streams = session.streams;
+    if (session.state != SESSION_ACTIVE || !session.notifying || !(streams & STREAM_RAW) ||
+        (now - session.lastFrameMs) < session.intervalMs)
+    {
+      continue;
+    }
+    session.lastFrameMs = now;
+    if (!encoded)
+    {
+      encodeFrame(values, frameSequence++, captureUs, messagePayload(frameMessage));
+      sealMessage(frameMessage, sizeof(frameMessage), MSG_FRAME, FRAME_PAYLOAD_SIZE);
+      encoded = true;
+    }
+    BatchFormat format = (streams & STREAM_CODED) && codedAllowed ? BATCH_CODED
+                         : (streams & STREAM_PACKED)             ? BATCH_PACKED
+                                                                 : BATCH_FRAME;
+    if (format == BATCH_PACKED && !packedEncoded)
+    {
+      packFrame(values, frameSequence - 1, captureUs, messagePayload(packedMessage)); // Same sequence number
+      sealMessage(packedMessage, sizeof(packedMessage), MSG_PACKED_FRAME, PACKED_FRAME_SIZE);
+      packedEncoded = true;
+    }
+    offerFrame(session, now, format);
+  }
+  if (encoded)
+  {
+    BINLOG(NOTIFY, sizeof(frameMessage));
+  }
+}
+
+void sessionsGattsEvent(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf, esp_ble_gatts_cb_param_t *param)
+{
+  if (event == ESP_GATTS_WRITE_EVT && cccd != NULL && param->write.handle == cccd->getHandle() &&
+      param->write.len == 2)
+  {
+    // Per connection, the BLE2902 descriptor itself only keeps the last value any central wrote
+    Session *session = sessionFind(param->write.conn_id);
+    if (session)
+    {
+      session->notifying = (param->write.value[0] & 0x01) != 0;
+    }
+  }
+  else if (event == ESP_GATTS_CONF_EVT && txCharacteristic != NULL && param->conf.handle == txCharacteristic->getHandle())
+  {
+    Session *session = sessionFind(param->conf.conn_id);
+    if (session)
+    {
+      session->pacer.completed(param->conf.status == ESP_GATT_OK);
+    }
+  }
+  else if (event == ESP_GATTS_CONGEST_EVT)
+  {
+    Session *session = sessionFind(param->congest.conn_id);
+    if (session)
+    {
+      session->pacer.setCongested(param->congest.congested);
+    }
+  }
+}
@@ -0,0 +1,116 @@
+#include "TelemetryView.h"
+#include "GlovePipeline.h"
+
+// Layout for the 240x135 landscape screen, the bottom 20 pixels belong to the status message
+#define BAR_X 10          // Left edge of the first bar
+#define BAR_TOP 8         // Top of a fully bent (90 degree) bar
+#define BAR_MAX 90        // One pixel per degree of bend
+#define BAR_AREA 160      // Bar pitch times the bar count, left of the dial
+#define BAR_PITCH (BAR_AREA / FLEX_COUNT)
+#define BAR_GAP (BAR_PITCH / 3)
+#define BAR_WIDTH (BAR_PITCH - BAR_GAP) // 22 wide with 10 between on a five finger glove
+#define DIAL_X 195        // Centre of the orientation dial
+#define DIAL_Y 54
+#define DIAL_RADIUS 32
+#define DOT_RADIUS 4
+#define GRAVITY_X100 981  // 1 g in the x100 units used by dataArray
+
+static_assert(BAR_WIDTH >= 3, "Too many flex channels for the telemetry bars");
+
+static const char fingerLabels[5] = {'T', 'I', 'M', 'R', 'P'};
+
+// The fingers by initial, any further channels (abduction, opposition) as a, b, c...
+static char barLabel(int channel)
+{
+  return channel < 5 ? fingerLabels[channel] : 'a' + channel - 5;
+}
+
+TelemetryView::TelemetryView(TFT_eSPI &display) : tft(display), dotX(DIAL_X), dotY(DIAL_Y), lastFrame(0)
+{
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    barHeight[i] = 0;
+  }
+}
+
+void TelemetryView::begin()
+{
+  tft.fillRect(0, 0, tft.width(), tft.height() - 20, TFT_BLACK); // Clear screen, excluding bottom area
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    int x = BAR_X + i * BAR_PITCH;
+    tft.drawRect(x - 1, BAR_TOP - 1, BAR_WIDTH + 2, BAR_MAX + 2, TFT_DARKGREY); // Outline around the bar
+    tft.drawChar(barLabel(i), x + BAR_WIDTH / 2 - 3, BAR_TOP + BAR_MAX + 4);
+    barHeight[i] = 0; // Bars start empty after the area was cleared
+  }
+
+  tft.drawCircle(DIAL_X, DIAL_Y, DIAL_RADIUS, TFT_DARKGREY);
+  tft.drawFastHLine(DIAL_X - DIAL_RADIUS, DIAL_Y, DIAL_RADIUS * 2, TFT_DARKGREY);
+  tft.drawFastVLine(DIAL_X, DIAL_Y - DIAL_RADIUS, DIAL_RADIUS * 2, TFT_DARKGREY);
+  dotX = DIAL_X;
+  dotY = DIAL_Y;
+  tft.fillCircle(dotX, dotY, DOT_RADIUS, TFT_CYAN);
+
+  lastFrame = 0; // Draw the first frame straight away
+}
+
+void TelemetryView::update(const int16_t *data)
+{
+  if ((millis() - lastFrame) < TELEMETRY_FRAME_MS)
+  {
+    return; // Frame rate cap, skip this sample
+  }
+  lastFrame = millis();
+
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    drawBar(i, data[i]);
+  }
+  drawOrientation(data[FRAME_IMU(0) + 3], data[FRAME_IMU(0) + 4]); // Accel x and y of the wrist IMU
+}
+
+// Grow or shrink a bar by filling only the rows between the old and the new height
+void TelemetryView::drawBar(int finger, int angle)
+{
+  int height = constrain(angle, 0, BAR_MAX);
+  int old = barHeight[finger];
+  if (height == old)
+  {
+    return;
+  }
+
+  int x = BAR_X + finger * BAR_PITCH;
+  int bottom = BAR_TOP + BAR_MAX;
+  if (height > old)
+  {
+    tft.fillRect(x, bottom - height, BAR_WIDTH, height - old, TFT_GREEN); // Extend the bar upwards
+  }
+  else
+  {
+    tft.fillRect(x, bottom - old, BAR_WIDTH, old - height, TFT_BLACK); // Erase the part that went away
+  }
+  barHeight[finger] = height;
+}
+
+// Bubble level: the dot is offset by the gravity components across the back of the hand
+void TelemetryView::drawOrientation(int16_t accelX, int16_t accelY)
+{
+  int range = DIAL_RADIUS - DOT_RADIUS - 1;
+  int x = DIAL_X + constrain((int32_t)accelX * range / GRAVITY_X100, -range, range);
+  int y = DIAL_Y + constrain((int32_t)accelY * range / GRAVITY_X100, -range, range);
+  if (x == dotX && y == dotY)
+  {
+    return;
+  }
+
+  tft.fillCircle(dotX, dotY, DOT_RADIUS, TFT_BLACK);
+  // Repair the crosshair where the old dot covered it
+  tft.drawFastHLine(dotX - DOT_RADIUS, DIAL_Y, DOT_RADIUS * 2 + 1, TFT_DARKGREY);
+  tft.drawFastVLine(DIAL_X, dotY - DOT_RADIUS, DOT_RADIUS * 2 + 1, TFT_DARKGREY);
+  tft.fillCircle(x, y, DOT_RADIUS, TFT_CYAN);
+  dotX = x;
+  dotY = y;
+}
@@ -15,35 +15,130 @@
 #include <esp32-hal.h>
 #include <TFT_eSPI.h> // Include the TFT display library
 #include "Tog.h"      // Include the boot image
+#include "TelemetryView.h"
+#include "MessageHistory.h"
+#include "HistoryView.h"
+#include "GlyphText.h"
+#include "TextLayout.h"
+#include "AppEvents.h"
+#include "Button.h"
+#include "FastTrig.h"
+#include "BinLog.h"
+#include "StageProfiler.h"
+#include "GlovePipeline.h"
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "Commands.h"
+#include "NotifyPacer.h"
+#include "ConnectionTuning.h"
+#include "Advertiser.h"
+#include "Sessions.h"
+#include "Recorder.h"
+#include "BulkDownload.h"
+#include <esp_gatts_api.h>
+#include <esp_timer.h>
 #include "FlexLibrary.h"
+#include "FlexScan.h"
 #include <Adafruit_MPU6050.h>
 #include <Adafruit_Sensor.h>
+#include <array>
+#include <utility>
 
 
 
-// MPU6050 IMU
-Adafruit_MPU6050 mpu;
+// Divider, sensor and IMU constants of the glove variant this build is for
+#include "GloveCalibration.h"
 
-// Flex sensors
-Flex flex[5] = {Flex(36), Flex(39), Flex(32), Flex(33), Flex(26)}; // Analog pins the flex sensors are on
+// MPU6050 IMUs, in frame order
+Adafruit_MPU6050 mpu[Glove::imuCount];
 
+// One Flex per channel on the pin it is converted on, a multiplexer's common pin
+// is shared by its channels
+template <size_t... Channel>
+std::array<Flex, sizeof...(Channel)> makeFlexSensors(std::index_sequence<Channel...>)
+{
+  return {Flex(Glove::channelPin(Channel))...};
+}
 
+std::array<Flex, Glove::flexCount> flex = makeFlexSensors(std::make_index_sequence<Glove::flexCount>());
 
-// Calibration variables for flex sensors
-#define VCC 5  // Supply voltage for flex sensors
-#define R_DIV 10000.0  // New R_DIV value for 3.3V setup
-float flatResistance[5] = {54642.00, 57937.00, 44730.00, 60732.00, 48805.00}; // Flat resistance of flex sensor
-float bendResistance[5] = {158494.00, 125896.00, 68138.00, 136138.00, 134915.00}; // Bend resistance of flex sensor
+// The scanner's view of the hardware, see FlexScan.h
+struct GloveScanIo
+{
+  void select(int mux, int input)
+  {
+    for (int bit = 0; bit < MUX_SELECT_BITS; bit++)
+    {
+      digitalWrite(Glove::selectPin(mux, bit), (input >> bit) & 1);
+    }
+  }
+
+  int convert(int channel)
+  {
+    flex[channel].updateVal();
+    return flex[channel].getSensorValue();
+  }
+
+  uint32_t nowUs() { return micros(); }
+
+  void waitUntilUs(uint32_t time)
+  {
+    while ((int32_t)(micros() - time) < 0)
+    {
+    }
+  }
+};
+
+GloveScanIo scanIo;
+FlexScanner<Glove, GloveScanIo> flexScanner(scanIo);
+
+// The profile's IMU settings as the driver's enums
+constexpr mpu6050_accel_range_t accelRange(int g)
+{
+  return g <= 2 ? MPU6050_RANGE_2_G : g <= 4 ? MPU6050_RANGE_4_G : g <= 8 ? MPU6050_RANGE_8_G : MPU6050_RANGE_16_G;
+}
+
+constexpr mpu6050_gyro_range_t gyroRange(int dps)
+{
+  return dps <= 250    ? MPU6050_RANGE_250_DEG
+         : dps <= 500  ? MPU6050_RANGE_500_DEG
+         : dps <= 1000 ? MPU6050_RANGE_1000_DEG
+                       : MPU6050_RANGE_2000_DEG;
+}
+
+constexpr mpu6050_bandwidth_t filterBandwidth(int hz)
+{
+  return hz <= 5    ? MPU6050_BAND_5_HZ
+         : hz <= 10 ? MPU6050_BAND_10_HZ
+         : hz <= 21 ? MPU6050_BAND_21_HZ
+         : hz <= 44 ? MPU6050_BAND_44_HZ
+         : hz <= 94 ? MPU6050_BAND_94_HZ
+         : hz <= 184 ? MPU6050_BAND_184_HZ
+                     : MPU6050_BAND_260_HZ;
+}
 
 
 
 
 const int CALIBRATION_ITERATIONS = 1000;
+const int CALIBRATION_BATCH = 50; // Calibration samples per sensor taken in one loop() pass
+int calibrationRemaining = 0;     // Samples left in the running calibration, 0 when idle
 const float MAX_SENSOR_VALUE = 4095.0;
 
-// Define the UUIDs for the BLE service and characteristic
-#define SERVICE_UUID "0000180d-0000-1000-8000-00805f9b34fb"
-#define CHARACTERISTIC_UUID "00002a37-0000-1000-8000-00805f9b34fb"
+// loop() sleeps on the event queue between deadlines instead of spinning
+#define SAMPLE_INTERVAL_US 2000 // 500 Hz acquisition, sessions and the views take every nth frame
+#define IDLE_WAIT_US 50000      // Nothing sampled or animated, only advertising and events to look after
+uint32_t nextSampleUs = 0;      // esp_timer time the next frame is due
+
+// Glove GATT service, every value is a GloveProtocol message
+#define SERVICE_UUID "a5f1e000-6c3b-4c8e-9f4a-2b7d1c0e5a11"
+#define TX_CHARACTERISTIC_UUID "a5f1e001-6c3b-4c8e-9f4a-2b7d1c0e5a11"    // Notify: frames and sync replies
+#define RX_CHARACTERISTIC_UUID "a5f1e002-6c3b-4c8e-9f4a-2b7d1c0e5a11"    // Write: letters, commands, sync requests
+#define STATS_CHARACTERISTIC_UUID "a5f1e010-6c3b-4c8e-9f4a-2b7d1c0e5a11" // Read-only stage timing histograms
+#define BULK_CHARACTERISTIC_UUID "a5f1e020-6c3b-4c8e-9f4a-2b7d1c0e5a11"  // Notify and write: recording downloads
+// Handles are handed out in creation order. Bonded centrals cache them, so only ever
+// append characteristics, and keep the service's handle count fixed with room to grow.
+#define SERVICE_HANDLES 32
 
 
 // MAY HAVE TO USE 15.5K OHM FOR R-DIV RESISTOR
@@ -51,17 +146,25 @@ const float MAX_SENSOR_VALUE = 4095.0;
 
 // Function declaration for wrapped text
 void drawWrappedText(const char *text, int x, int y); // Forward declaration
+void showLatestMessage();
+void handleEvent(const AppEvent &event);
+void drawConnectionStatus();
+void setRecording(bool on);
+bool calibrateStep();
+void showReceivedText(const char *text, size_t length);
 
 // BLE server and characteristic
 BLEServer *pServer = NULL;                 // BLE server object
 BLECharacteristic *pCharacteristic = NULL; // Characteristic to send data
-bool deviceConnected = false;              // Connection status
+BLECharacteristic *pRxCharacteristic = NULL; // Messages from the app
+BLECharacteristic *pStatsCharacteristic = NULL; // Stage timings, see StageProfiler::serialize
+BLECharacteristic *pBulkCharacteristic = NULL;  // Recording downloads, see BulkDownload.h
+bool deviceConnected = false;              // At least one central connected, each one has a Session
 
-const int buttonPin = 35; // Button GPIO 35 for toggling text size
-unsigned long lastTime = 0;
-unsigned long timerDelay = 100; // 0.1 second interval
+const int buttonPin = 35; // Button GPIO 35, presses are bound to actions below
 
-int16_t dataArray[11] = {0}; // Initialize an empty data array with 11 elements
+int16_t dataArray[FRAME_VALUES] = {0}; // Flex angles, then gyro and accel of every IMU (GlovePipeline.h)
+uint32_t frameCaptureUs = 0;  // esp_timer time the sensors in dataArray were read
 
 // Initialize TFT display
 TFT_eSPI tft = TFT_eSPI(); // Create TFT object
@@ -72,8 +175,37 @@ void displayStatusMessage(const char *message, uint16_t textColor, uint16_t bgCo
 // Global variable to track text size (initially set to 1)
 int textSize = 1;
 
-// Global variable to store the last displayed message
-String lastMessage = "";
+// Recent messages from the app, the newest one is what the text view shows
+MessageHistory messageHistory;
+
+// What the main area of the screen shows, cycled with the button
+enum DisplayView
+{
+  VIEW_TEXT,      // Text received from the app
+  VIEW_TELEMETRY, // Live finger bars and orientation
+  VIEW_HISTORY    // Scrollback of earlier messages (portrait)
+};
+DisplayView currentView = VIEW_TEXT;
+TelemetryView telemetryView(tft);
+HistoryView historyView(tft, messageHistory);
+
+// What a button event does, bound per view
+enum ButtonAction
+{
+  ACTION_NONE,
+  ACTION_TEXT_SIZE,    // Toggle text size 1 / 2
+  ACTION_NEXT_VIEW,    // Text -> telemetry -> history -> text
+  ACTION_PAGE_HISTORY, // One screen back through the history, wraps to the newest
+  ACTION_CALIBRATE,    // Start a flex sensor calibration
+  ACTION_RECORD        // Start or stop recording to flash
+};
+
+// Indexed by [DisplayView][AppEventType] for EVENT_BUTTON_SHORT, _DOUBLE, _LONG
+ButtonAction buttonBindings[3][3] = {
+    {ACTION_TEXT_SIZE, ACTION_NEXT_VIEW, ACTION_CALIBRATE},    // VIEW_TEXT
+    {ACTION_RECORD, ACTION_NEXT_VIEW, ACTION_CALIBRATE},       // VIEW_TELEMETRY
+    {ACTION_PAGE_HISTORY, ACTION_NEXT_VIEW, ACTION_CALIBRATE}, // VIEW_HISTORY
+};
 
 void drawStatusMessage(const char *message, uint16_t textColor, uint16_t bgColor)
 {
@@ -91,91 +223,279 @@ void drawStatusMessage(const char *message, uint16_t textColor, uint16_t bgColor
 // Setup callbacks for connect and disconnect
 class MyServerCallbacks : public BLEServerCallbacks
 {
-  void onConnect(BLEServer *pServer)
+  void onConnect(BLEServer *pServer, esp_ble_gatts_cb_param_t *param)
   {
-    tft.fillScreen(TFT_BLACK); // Clear the screen
-    deviceConnected = true;
-    Serial.println("Connected to central device");
+    PROFILE_STAGE(STAGE_CONNECT_CB);
+    uint16_t connId = param->connect.conn_id;
+    Session *session = sessionOpen(connId, param->connect.remote_bda);
+    if (!session)
+    {
+      pServer->disconnect(connId); // Every session slot is taken
+      return;
+    }
+    connectionTuningConnected(param->connect.remote_bda, session->connection, PROFILE_LOW_LATENCY);
+    BINLOG(CONNECTED, connId, sessionCount());
 
-    // Draw "Connected" status message
-    drawStatusMessage("Connected", TFT_BLACK, TFT_GREEN);
+    bool first = !deviceConnected;
+    deviceConnected = true;
+    postEvent(EVENT_CONNECTED, first); // The display and the advertiser belong to loop()
   }
 
-  void onDisconnect(BLEServer *pServer)
+  void onDisconnect(BLEServer *pServer, esp_ble_gatts_cb_param_t *param)
   {
-    deviceConnected = false;
-    BLEDevice::startAdvertising(); // Restart advertising
-    Serial.println("Disconnected from central device");
+    PROFILE_STAGE(STAGE_CONNECT_CB);
+    connectionTuningDisconnected(param->disconnect.remote_bda, sessionFind(param->disconnect.conn_id)); // Before it closes
+    sessionClose(param->disconnect.conn_id);
+    bulkDisconnected(param->disconnect.conn_id);
+    deviceConnected = sessionCount() > 0;
+    BINLOG(DISCONNECTED, param->disconnect.conn_id, sessionCount());
+    postEvent(EVENT_DISCONNECTED, sessionCount());
+  }
 
-    // Draw "Disconnected" status message
-    drawStatusMessage("Disconnected", TFT_WHITE, TFT_RED);
+  void onMtuChanged(BLEServer *pServer, esp_ble_gatts_cb_param_t *param)
+  {
+    sessionMtuChanged(param->mtu.conn_id, param->mtu.mtu);
   }
 };
 
+// Commands arrive on the BLE task, anything that touches loop() state is handed over as an event
+void handleCommand(Session &session, const uint8_t *payload, size_t length)
+{
+  Command command;
+  CommandStatus status = parseCommand(payload, length, &command);
+  if (status != COMMAND_OK)
+  {
+    BINLOG(BAD_COMMAND, length > 0 ? payload[0] : 0, status);
+    return;
+  }
+
+  switch (command.opcode)
+  {
+  case CMD_SET_RATE:
+    postEvent(EVENT_SET_RATE, ((int32_t)session.connId << 16) | command.value);
+    break;
+  case CMD_SET_MODE:
+    postEvent(EVENT_SET_MODE, command.value);
+    break;
+  case CMD_CALIBRATE:
+    postEvent(EVENT_CALIBRATE);
+    break;
+  case CMD_DISPLAY_TEXT:
+    if (!postText(EVENT_TEXT, command.text, command.length)) // Shown by loop(), the payload is gone after this callback
+    {
+      BINLOG(TEXT_DROPPED, command.length);
+    }
+    break;
+  case CMD_QUERY_STATS:
+    postEvent(EVENT_QUERY_STATS, session.connId);
+    break;
+  case CMD_SET_BROADCAST:
+    postEvent(EVENT_SET_BROADCAST, command.value != 0);
+    break;
+  case CMD_SET_PROFILE:
+    connectionRequestProfile(session.peer, session.connection, (ConnectionProfile)command.value); // Granted values arrive via GAP events
+    break;
+  case CMD_SUBSCRIBE:
+    postEvent(EVENT_SUBSCRIBE, ((int32_t)session.connId << 16) | command.value);
+    break;
+  case CMD_RECORD:
+    postEvent(EVENT_RECORD, command.value);
+    break;
+  }
+  BINLOG(COMMAND, command.opcode, command.value);
+}
+
 // Setup callback for characteristic write
 class MyCallbacks : public BLECharacteristicCallbacks
 {
-  void onWrite(BLECharacteristic *pCharacteristic)
+  void onWrite(BLECharacteristic *pCharacteristic, esp_ble_gatts_cb_param_t *param)
   {
-    std::string value = pCharacteristic->getValue(); // Get the value written to the characteristic
+    PROFILE_STAGE(STAGE_WRITE_CB);
+    uint64_t received = esp_timer_get_time(); // t2 for a clock sync request
+    Session *session = sessionFind(param->write.conn_id);
+    if (!session)
+    {
+      return;
+    }
+
+    // Parsed in place from the characteristic's own buffer, nothing here allocates
+    Message message;
+    ProtocolStatus status = parseMessage(pCharacteristic->getData(), pCharacteristic->getLength(), &message);
+    if (status != PROTOCOL_OK)
+    {
+      BINLOG(BAD_MESSAGE, status, pCharacteristic->getLength());
+      return;
+    }
 
-    if (value.length() > 0)
+    if (message.type == MSG_SYNC && message.length == SYNC_REQUEST_SIZE)
+    {
+      // Clock sync: answer with t1, t2 and the send time t3, only to the central that asked
+      uint8_t reply[PROTOCOL_OVERHEAD + SYNC_REPLY_SIZE];
+      encodeSyncReply(getLE(message.payload, 8), received, esp_timer_get_time(), messagePayload(reply));
+      sessionNotify(*session, reply, sizeof(reply), MSG_SYNC, SYNC_REPLY_SIZE);
+    }
+    else if (message.type == MSG_LETTER)
     {
-      Serial.print("Received from app: ");
-      for (int i = 0; i < value.length(); i++)
+      if (!postText(EVENT_LETTER, (const char *)message.payload, message.length)) // Shown and fanned out from loop()
       {
-        Serial.print(value[i]);
+        BINLOG(TEXT_DROPPED, message.length);
       }
-      Serial.println();
+      BINLOG(APP_WRITE, message.length);
+    }
+    else if (message.type == MSG_COMMAND)
+    {
+      handleCommand(*session, message.payload, message.length);
+    }
+    else
+    {
+      BINLOG(UNHANDLED_MESSAGE, message.type, message.length);
+    }
+  }
+};
 
-      // Clear only the main area, without clearing the status message
-      tft.fillRect(0, 0, tft.width(), tft.height() - 20, TFT_BLACK); // Clear screen, excluding bottom area
+// loop() records the stages, so it also takes the copy the stats characteristic serves
+static uint8_t statsSnapshot[PROTOCOL_OVERHEAD + 1 + STAGE_COUNT * STAGE_STATS_WIRE_SIZE];
+static size_t statsSnapshotLength = 0;
+static uint32_t statsSnapshotMs = 0;
+static portMUX_TYPE statsSnapshotLock = portMUX_INITIALIZER_UNLOCKED;
 
-      // Store the received message
-      lastMessage = String(value.c_str());
+static void snapshotStats()
+{
+  uint8_t message[sizeof(statsSnapshot)];
+  size_t length = profiler.serialize(messagePayload(message), sizeof(message) - PROTOCOL_OVERHEAD);
+  length = sealMessage(message, sizeof(message), MSG_STATS, length);
+  portENTER_CRITICAL(&statsSnapshotLock);
+  memcpy(statsSnapshot, message, length);
+  statsSnapshotLength = length;
+  portEXIT_CRITICAL(&statsSnapshotLock);
+  statsSnapshotMs = millis();
+}
 
-      // Set the text size based on the current textSize value
-      tft.setTextSize(textSize);
-      tft.setTextColor(TFT_WHITE, TFT_BLACK);       // Set text color and background
-      drawWrappedText(lastMessage.c_str(), 10, 20); // Display the received text with wrapping
+// Fill the stats characteristic with loop()'s latest snapshot on every read
+class StatsCallbacks : public BLECharacteristicCallbacks
+{
+  void onRead(BLECharacteristic *pCharacteristic)
+  {
+    uint8_t message[sizeof(statsSnapshot)];
+    portENTER_CRITICAL(&statsSnapshotLock);
+    size_t length = statsSnapshotLength;
+    memcpy(message, statsSnapshot, length);
+    portEXIT_CRITICAL(&statsSnapshotLock);
+    pCharacteristic->setValue(message, length);
+  }
+};
 
-      // Echo back the received data
-      pCharacteristic->setValue((uint8_t *)value.c_str(), value.length());
-      Serial.print("Echoed back to app: ");
-      Serial.println(value.c_str());
-    }
+// Download requests, handled by the bulk task
+class BulkCallbacks : public BLECharacteristicCallbacks
+{
+  void onWrite(BLECharacteristic *pCharacteristic, esp_ble_gatts_cb_param_t *param)
+  {
+    bulkWrite(param->write.conn_id, pCharacteristic->getData(), pCharacteristic->getLength());
   }
 };
 
-void drawLoadingIcon(int x, int y, int frame)
+// Completions and congestion for both notifying characteristics
+static void gattsEvent(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf, esp_ble_gatts_cb_param_t *param)
 {
-  int radius = 10;                      // Radius of the loading icon
-  int segments = 12;                    // Number of segments in the loading icon
-  int angle = (360 / segments) * frame; // Calculate the angle for the current frame
+  sessionsGattsEvent(event, gattsIf, param);
+  bulkGattsEvent(event, gattsIf, param);
+}
 
-  // Clear the previous frame
-  tft.fillCircle(x, y, radius + 2, TFT_BLACK);
+// The same stats as the characteristic, fresh from loop(), pushed on the TX characteristic
+void notifyStats(Session &session)
+{
+  static uint8_t snapshot[PROTOCOL_OVERHEAD + 1 + STAGE_COUNT * STAGE_STATS_WIRE_SIZE];
+  size_t length = profiler.serialize(messagePayload(snapshot), sizeof(snapshot) - PROTOCOL_OVERHEAD);
+  sessionNotify(session, snapshot, sizeof(snapshot), MSG_STATS, length);
+}
 
-  // Draw the current frame
-  for (int i = 0; i < segments; i++)
+// Pacing and drop counters of this central's frame stream
+void notifyLinkStats(Session &session)
+{
+  uint8_t message[PROTOCOL_OVERHEAD + LINK_STATS_WIRE_SIZE];
+  size_t length = session.pacer.serialize(messagePayload(message), LINK_STATS_WIRE_SIZE);
+  sessionNotify(session, message, sizeof(message), MSG_LINK, length);
+}
+
+// Connection parameters, data length, MTU and PHY the central granted
+void notifyConnectionInfo(Session &session)
+{
+  uint8_t message[PROTOCOL_OVERHEAD + CONNECTION_INFO_WIRE_SIZE];
+  size_t length = serializeConnectionInfo(session.connection, messagePayload(message), CONNECTION_INFO_WIRE_SIZE);
+  sessionNotify(session, message, sizeof(message), MSG_CONNECTION, length);
+}
+
+void notifyAllStats(Session &session)
+{
+  notifyStats(session);
+  notifyLinkStats(session);
+  notifyConnectionInfo(session);
+}
+
+// The newest letter to every central subscribed to letters
+void publishLetter()
+{
+  static uint8_t message[PROTOCOL_OVERHEAD + HISTORY_MESSAGE_LEN];
+  size_t length = messageHistory.length(0);
+  memcpy(messagePayload(message), messageHistory.latest(), length);
+  sessionsNotify(STREAM_LETTERS, message, sizeof(message), MSG_LETTER, length);
+}
+
+// Spinner segment endpoints relative to the centre, computed once from the sine table
+#define SPINNER_SEGMENTS 12
+#define SPINNER_RADIUS 10
+int8_t spinnerOuter[SPINNER_SEGMENTS][2];
+int8_t spinnerInner[SPINNER_SEGMENTS][2];
+int spinnerHead = -1; // Highlighted segment on screen, -1 before the first frame
+
+void drawSpinnerSegment(int x, int y, int segment, uint16_t color)
+{
+  tft.drawLine(x + spinnerOuter[segment][0], y + spinnerOuter[segment][1], x + spinnerInner[segment][0],
+               y + spinnerInner[segment][1], color);
+}
+
+// Only the segment losing the highlight and the one gaining it are redrawn per frame
+void drawLoadingIcon(int x, int y, int frame)
+{
+  if (spinnerHead < 0)
   {
-    int segmentAngle = angle + (360 / segments) * i;
-    int x1 = x + radius * cos(radians(segmentAngle));
-    int y1 = y + radius * sin(radians(segmentAngle));
-    int x2 = x + (radius - 3) * cos(radians(segmentAngle));
-    int y2 = y + (radius - 3) * sin(radians(segmentAngle));
-    tft.drawLine(x1, y1, x2, y2, TFT_WHITE);
+    for (int i = 0; i < SPINNER_SEGMENTS; i++)
+    {
+      int angle = (360 / SPINNER_SEGMENTS) * i;
+      spinnerOuter[i][0] = scaleQ15(SPINNER_RADIUS, icos(angle));
+      spinnerOuter[i][1] = scaleQ15(SPINNER_RADIUS, isin(angle));
+      spinnerInner[i][0] = scaleQ15(SPINNER_RADIUS - 3, icos(angle));
+      spinnerInner[i][1] = scaleQ15(SPINNER_RADIUS - 3, isin(angle));
+      drawSpinnerSegment(x, y, i, TFT_DARKGREY);
+    }
+  }
+
+  int head = frame % SPINNER_SEGMENTS;
+  if (head == spinnerHead)
+  {
+    return;
+  }
+  if (spinnerHead >= 0)
+  {
+    drawSpinnerSegment(x, y, spinnerHead, TFT_DARKGREY);
   }
+  drawSpinnerSegment(x, y, head, TFT_WHITE);
+  spinnerHead = head;
 }
 
 void setup()
 {
-
-  Serial.println("Adafruit MPU6050 test!");
+  Serial.begin(115200);
+  binlogBegin(); // Log records are drained to the serial port by a background task
+  BINLOG(BOOT);
 
   // Try to initialize!
-  if (!mpu.begin()) {
-    Serial.println("Failed to find MPU6050 chip");
+  bool imusFound = true;
+  for (int i = 0; i < Glove::imuCount; i++) {
+    imusFound = mpu[i].begin(Glove::imuAddresses[i]) && imusFound;
+  }
+  if (!imusFound) {
+    BINLOG(MPU_MISSING);
     tft.setSwapBytes(true); // Swap the byte order for the display
     tft.init();
     tft.pushImage(0, 0, 135, 240, Tog); // Display the boot image
@@ -197,20 +517,30 @@ void setup()
       delay(10);
     }
   }
-  Serial.println("MPU6050 Found!");
+  BINLOG(MPU_FOUND);
+
+  for (int i = 0; i < Glove::imuCount; i++) {
+    mpu[i].setAccelerometerRange(accelRange(Glove::imuAccelRangeG));
+    mpu[i].setGyroRange(gyroRange(Glove::imuGyroRangeDps));
+    mpu[i].setFilterBandwidth(filterBandwidth(Glove::imuFilterHz));
+  }
 
-  mpu.setAccelerometerRange(MPU6050_RANGE_8_G);
-  mpu.setGyroRange(MPU6050_RANGE_500_DEG);
-  mpu.setFilterBandwidth(MPU6050_BAND_21_HZ);
+  // Multiplexer select lines, then every mux on its first channel of a scan
+  for (int mux = 0; mux < Glove::muxCount; mux++) {
+    for (int bit = 0; bit < MUX_SELECT_BITS; bit++) {
+      pinMode(Glove::selectPin(mux, bit), OUTPUT);
+    }
+  }
+  flexScanner.begin();
 
 
 
   
 
-  pinMode(buttonPin, INPUT_PULLUP); // Initialize the button pin as an input with pull-up resistor
+  appEventsBegin();
+  buttonBegin(buttonPin); // Button pin as input with pull-up, presses arrive as events
+  recorderBegin();        // Mounts LittleFS, formats it on the first boot
 
-  Serial.begin(115200);
-  Serial.println("Starting BLE work!");
 
 
   // Initialize TFT
@@ -241,133 +571,415 @@ void setup()
 
   // Initialize BLE
   BLEDevice::init("Interpreter Glove");
+  BLEDevice::setCustomGattsHandler(gattsEvent);
+  connectionTuningBegin();
   pServer = BLEDevice::createServer();
   pServer->setCallbacks(new MyServerCallbacks());
 
-  BLEService *pService = pServer->createService(SERVICE_UUID);
-  pCharacteristic = pService->createCharacteristic(
-      CHARACTERISTIC_UUID,
-      BLECharacteristic::PROPERTY_WRITE | BLECharacteristic::PROPERTY_NOTIFY);
+  BLEService *pService = pServer->createService(BLEUUID(SERVICE_UUID), SERVICE_HANDLES);
+  pCharacteristic = pService->createCharacteristic(TX_CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_NOTIFY);
 
   // Add a BLE2902 descriptor to support notifications
   pCharacteristic->addDescriptor(new BLE2902());
-  pCharacteristic->setCallbacks(new MyCallbacks());
+
+  pRxCharacteristic = pService->createCharacteristic(
+      RX_CHARACTERISTIC_UUID,
+      BLECharacteristic::PROPERTY_WRITE | BLECharacteristic::PROPERTY_WRITE_NR);
+  pRxCharacteristic->setCallbacks(new MyCallbacks());
+
+  pStatsCharacteristic = pService->createCharacteristic(STATS_CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_READ);
+  pStatsCharacteristic->setCallbacks(new StatsCallbacks());
+  snapshotStats(); // All zero until loop() has timed something
+
+  pBulkCharacteristic = pService->createCharacteristic(
+      BULK_CHARACTERISTIC_UUID,
+      BLECharacteristic::PROPERTY_NOTIFY | BLECharacteristic::PROPERTY_WRITE | BLECharacteristic::PROPERTY_WRITE_NR);
+  pBulkCharacteristic->addDescriptor(new BLE2902());
+  pBulkCharacteristic->setCallbacks(new BulkCallbacks());
 
   pService->start();
+  sessionsBegin(pServer, pCharacteristic, SAMPLE_INTERVAL_US);
+  bulkBegin(pServer, pBulkCharacteristic);
 
-  // Start advertising
-  BLEAdvertising *pAdvertising = BLEDevice::getAdvertising();
-  pAdvertising->addServiceUUID(SERVICE_UUID);
-  pAdvertising->setScanResponse(true);
-  pAdvertising->setMinPreferred(0x06);
-  pAdvertising->setMinPreferred(0x12);
-  BLEDevice::startAdvertising();
-  Serial.println("Bluetooth device active, waiting for connections...");
+  // Start advertising, the scan response carries the low latency profile as the preferred connection interval
+  advertiserBegin(BLEUUID(SERVICE_UUID), "Interpreter Glove", connectionParams(PROFILE_LOW_LATENCY).minInterval,
+                  connectionParams(PROFILE_LOW_LATENCY).maxInterval);
+  BINLOG(ADVERTISING);
+
+  // Initial calibration before the first frame
+  calibrationRemaining = CALIBRATION_ITERATIONS;
+  while (!calibrateStep())
+  {
+  }
 }
 
 
 
-void calibrateSensors() {
-    for (int i = 0; i < 5; i++) {
-        for (int j = 0; j < CALIBRATION_ITERATIONS; j++) {
+// Take the next batch of calibration samples, CALIBRATION_ITERATIONS per sensor in total.
+// Returns true when this batch finished the calibration.
+bool calibrateStep() {
+    int batch = min(CALIBRATION_BATCH, calibrationRemaining);
+    for (int i = 0; i < Glove::flexCount; i++) {
+        flexScanner.hold(i); // A multiplexed channel has to be switched to first
+        for (int j = 0; j < batch; j++) {
             flex[i].Calibrate();
         }
         flex[i].updateVal();
     }
+    flexScanner.begin();
+    calibrationRemaining -= batch;
+    return calibrationRemaining == 0;
 }
 
-// Modify processSensorData to use the specific flat resistance values for each sensor
-void processSensorData(float* angles) {
-    for (int i = 0; i < 5; i++) {
-        flex[i].updateVal();
-        float Vflex = flex[i].getSensorValue() * VCC / 4095.0;
-        float Rflex = R_DIV * (VCC / Vflex - 1.0);
-        
-        // Use specific flat resistance for each sensor
-        float angle = map(Rflex, flatResistance[i], bendResistance[i], 0, 90);
-        
-        if (angle < 0) {
-            angle = 0;
-        }
-        
-        dataArray[i] = static_cast<int16_t>(angle);
+void startCalibration() {
+    calibrationRemaining = CALIBRATION_ITERATIONS;
+    if (currentView != VIEW_HISTORY) {
+        drawStatusMessage("Calibrating", TFT_BLACK, TFT_YELLOW);
     }
 }
 
-void sendDataIfNeeded() {
-    if ((millis() - lastTime) > timerDelay) {
-        pCharacteristic->setValue((uint8_t *)dataArray, sizeof(dataArray));
-        pCharacteristic->notify();      // Notify the central device (app)
+// Read the flex sensors and convert them with the calibration of this glove variant
+void processSensorData() {
+    int raw[Glove::flexCount];
+    {
+        PROFILE_STAGE(STAGE_ADC);
+        flexScanner.scan(raw); // Multiplexers switch and settle while the ADC converts
+    }
 
-      Serial.println("Sent int16_t data array to app:");
+    PROFILE_STAGE(STAGE_ANGLES);
+    Glove::flexAngles(raw, dataArray); // Table lookups, the divider math was done at compile time
+}
 
-      for (int i = 0; i < sizeof(dataArray) / sizeof(dataArray[0]); i++)
+void loop()
+{
+  sessionsUpdate(); // Start the sessions the BLE task opened, free the ones it closed
+  if (recorderFailed())
+  {
+    recorderStop(); // The writer already closed the file
+    if (currentView != VIEW_HISTORY)
+    {
+      drawStatusMessage("Record failed", TFT_WHITE, TFT_RED);
+    }
+  }
+  bool sampling = deviceConnected || currentView == VIEW_TELEMETRY || recorderActive(); // Also for the telemetry view and recordings
+  if (sampling && (int32_t)((uint32_t)esp_timer_get_time() - nextSampleUs) >= 0)
+  {
+    PROFILE_STAGE(STAGE_FRAME);
+    sensors_event_t a[Glove::imuCount], g[Glove::imuCount], temp;
+    frameCaptureUs = (uint32_t)esp_timer_get_time();
+    nextSampleUs += SAMPLE_INTERVAL_US;
+    if ((int32_t)(frameCaptureUs - nextSampleUs) >= 0)
+    {
+      nextSampleUs = frameCaptureUs + SAMPLE_INTERVAL_US; // Fell behind or just started, no catching up
+    }
+    {
+      PROFILE_STAGE(STAGE_IMU);
+      for (int i = 0; i < Glove::imuCount; i++)
       {
-        Serial.print(dataArray[i]);
-        Serial.print(" ");
+        mpu[i].getEvent(&a[i], &g[i], &temp);
       }
+    }
 
-      Serial.println();
-      lastTime = millis();
+    processSensorData();
+
+    // Gyroscope and accelerometer values, scaled by 100 to avoid floating point
+    for (int i = 0; i < Glove::imuCount; i++)
+    {
+      float gyro[3] = {g[i].gyro.x, g[i].gyro.y, g[i].gyro.z};
+      float accel[3] = {a[i].acceleration.x, a[i].acceleration.y, a[i].acceleration.z};
+      imuToFrame(gyro, accel, dataArray, i);
     }
-}
 
-void loop()
-{    
- if (deviceConnected)
-  {
-    float angles[5];
-    sensors_event_t a, g, temp;
-    mpu.getEvent(&a, &g, &temp);
+    {
+      PROFILE_STAGE(STAGE_RECORD);
+      recorderAdd(dataArray, frameCaptureUs); // Only encodes into RAM, a background task writes the flash
+    }
 
-    calibrateSensors();
-    processSensorData(angles);
-    
+    if (deviceConnected)
+    {
+      PROFILE_STAGE(STAGE_NOTIFY);
+      sessionsPublishFrame(dataArray, frameCaptureUs); // Each central at its own rate and batching
+    }
 
-    // Read gyroscope values
-    dataArray[5] = static_cast<int16_t>(g.gyro.x * 100); // Scale to avoid floating point
-    dataArray[6] = static_cast<int16_t>(g.gyro.y * 100);
-    dataArray[7] = static_cast<int16_t>(g.gyro.z * 100);
+    if (currentView == VIEW_TELEMETRY)
+    {
+      PROFILE_STAGE(STAGE_DISPLAY);
+      telemetryView.update(dataArray); // Only redraws the bar deltas, rate limited
+    }
 
-    // Read accelerometer values
-    dataArray[8] = static_cast<int16_t>(-a.acceleration.x * 100); // Scale to avoid floating point
-    dataArray[9] = static_cast<int16_t>(a.acceleration.y * 100);
-    dataArray[10] = static_cast<int16_t>(a.acceleration.z * 100);
+    // Frame dump, compiled out unless BINLOG_LEVEL is DEBUG
+    PROFILE_STAGE(STAGE_LOG);
+    int flex = 0;
+    for (; flex + 4 <= FLEX_COUNT; flex += 4)
+    {
+      BINLOG(FLEX_ANGLES, dataArray[flex], dataArray[flex + 1], dataArray[flex + 2], dataArray[flex + 3]);
+    }
+    for (; flex < FLEX_COUNT; flex++)
+    {
+      BINLOG(FLEX_ANGLE, flex, dataArray[flex]);
+    }
+    for (int i = 0; i < IMU_COUNT; i++)
+    {
+      const int16_t *imu = dataArray + FRAME_IMU(i);
+      BINLOG(IMU_GYRO, i, imu[0] / (float)IMU_SCALE, imu[1] / (float)IMU_SCALE, imu[2] / (float)IMU_SCALE);
+      BINLOG(IMU_ACCEL, i, imu[3] / (float)IMU_SCALE, imu[4] / (float)IMU_SCALE, imu[5] / (float)IMU_SCALE);
+    }
+  }
 
-    sendDataIfNeeded();
+  if ((millis() - statsSnapshotMs) >= SESSION_STATS_MS)
+  {
+    snapshotStats(); // For the stats characteristic, read on the BLE task
+  }
 
-    for (int i = 0; i < 11; i++) {
-    if (i >= 5 && i <= 10) {
-        // For scaled gyroscope and accelerometer values, divide by 100.0 to convert back to float
-        Serial.print(dataArray[i] / 100.0, 2);  // 2 decimal places for clarity
-    } else {
-        // Print other values as they are
-        Serial.print(dataArray[i]);
+  // Stats stream for the centrals that subscribed to it
+  for (int i = 0; i < SESSION_MAX; i++)
+  {
+    Session &session = sessions[i];
+    if (session.state == SESSION_ACTIVE && (session.streams & STREAM_STATS) && (millis() - session.lastStatsMs) >= SESSION_STATS_MS)
+    {
+      session.lastStatsMs = millis();
+      notifyAllStats(session);
     }
+  }
+
+  // Handle button presses reported by the button task
+  AppEvent event;
+  while (nextEvent(&event))
+  {
+    handleEvent(event);
+  }
 
-    if (i < 10) {
-        Serial.print(", ");
+  // Calibration is spread over frames so acquisition keeps running
+  if (calibrationRemaining > 0 && calibrateStep())
+  {
+    BINLOG(CALIBRATED);
+    if (currentView != VIEW_HISTORY)
+    {
+      drawConnectionStatus(); // Replace the "Calibrating" message
     }
+  }
+
+  if (currentView == VIEW_HISTORY)
+  {
+    PROFILE_STAGE(STAGE_DISPLAY);
+    historyView.update(); // Advance the hardware scroll animation
+  }
+
+  if (!deviceConnected)
+  {
+    advertiserUpdate(); // Drops to the slow interval once the fast burst is over
+  }
+
+  // Sleep until the next frame or animation step, an event wakes loop() early
+  uint32_t waitUs = IDLE_WAIT_US;
+  if (calibrationRemaining > 0)
+  {
+    waitUs = 0;
+  }
+  else if (sampling)
+  {
+    int32_t untilSample = (int32_t)(nextSampleUs - (uint32_t)esp_timer_get_time());
+    waitUs = untilSample > 0 ? untilSample : 0;
+  }
+  else if (currentView == VIEW_HISTORY)
+  {
+    waitUs = HISTORY_STEP_MS * 1000;
+  }
+  if (waitUs > 0 && waitEvent(&event, waitUs))
+  {
+    handleEvent(event);
+  }
 }
 
-    // Check if the button is pressed
-    if (digitalRead(buttonPin) == LOW)
-    { // Button is pressed (LOW because of INPUT_PULLUP)
-      Serial.println("Button pressed!");
+void switchView(DisplayView view)
+{
+  if (currentView == VIEW_HISTORY)
+  {
+    historyView.end();
+    drawConnectionStatus();
+  }
+  currentView = view;
 
-      // Toggle the text size between 1 and 2
-      textSize = (textSize == 1) ? 2 : 1;
+  if (view == VIEW_TEXT)
+  {
+    showLatestMessage();
+  }
+  else if (view == VIEW_TELEMETRY)
+  {
+    telemetryView.begin(); // Draws the static layout, bars follow on the next update
+  }
+  else
+  {
+    historyView.begin();
+  }
+}
 
-      // Clear the main area and redraw the last message with the new text size
-      tft.fillRect(0, 0, tft.width(), tft.height() - 20, TFT_BLACK); // Clear screen, excluding bottom area
-      tft.setTextSize(textSize);
-      drawWrappedText(lastMessage.c_str(), 10, 20); // Redraw the last message with the updated text size
+void handleEvent(const AppEvent &event)
+{
+  switch (event.type)
+  {
+  case EVENT_SET_RATE:
+  {
+    Session *session = sessionFind(event.arg >> 16); // Connection id in the high half, interval in the low
+    if (session)
+    {
+      session->intervalMs = event.arg & 0xFFFF;
+    }
+    return;
+  }
+  case EVENT_SUBSCRIBE:
+  {
+    Session *session = sessionFind(event.arg >> 16); // Connection id in the high half, stream mask in the low
+    if (session)
+    {
+      session->streams = event.arg & 0xFF;
+    }
+    return;
+  }
+  case EVENT_SET_MODE:
+    if (event.arg != currentView)
+    {
+      switchView((DisplayView)event.arg);
+    }
+    return;
+  case EVENT_CALIBRATE:
+    startCalibration();
+    return;
+  case EVENT_QUERY_STATS:
+  {
+    Session *session = sessionFind(event.arg); // Only the central that asked gets the answer
+    if (session)
+    {
+      notifyAllStats(*session);
+    }
+    return;
+  }
+  case EVENT_TEXT:
+  case EVENT_LETTER:
+  {
+    size_t length;
+    const char *text = eventText(event, &length);
+    showReceivedText(text, length);
+    releaseText(event);
+    if (event.type == EVENT_LETTER)
+    {
+      publishLetter();
+    }
+    return;
+  }
+  case EVENT_CONNECTED:
+    advertiserConnected(sessionCount() == SESSION_MAX); // Keep accepting centrals while there is room
+    if (event.arg && currentView != VIEW_HISTORY) // Status is drawn when leaving the history view
+    {
+      tft.fillScreen(TFT_BLACK);
+      drawStatusMessage("Connected", TFT_BLACK, TFT_GREEN);
+      if (currentView == VIEW_TELEMETRY)
+      {
+        telemetryView.begin();
+      }
+    }
+    return;
+  case EVENT_DISCONNECTED:
+    advertiserDisconnected(); // Fast burst so the phone finds the glove again quickly
+    if (event.arg == 0 && currentView != VIEW_HISTORY)
+    {
+      drawStatusMessage("Disconnected", TFT_WHITE, TFT_RED);
+    }
+    return;
+  case EVENT_RECORD:
+    setRecording(event.arg != 0);
+    return;
+  case EVENT_SET_BROADCAST:
+    advertiserSetBroadcast(event.arg != 0);
+    return;
+  default:
+    break; // Button events go through the per-view bindings
+  }
 
-      // Small delay to debounce the button
-      delay(200);
+  ButtonAction action = buttonBindings[currentView][event.type];
+  BINLOG(BUTTON, event.type, action);
+  switch (action)
+  {
+  case ACTION_TEXT_SIZE:
+    textSize = (textSize == 1) ? 2 : 1;
+    showLatestMessage();
+    break;
+  case ACTION_NEXT_VIEW:
+    switchView(currentView == VIEW_TEXT ? VIEW_TELEMETRY : currentView == VIEW_TELEMETRY ? VIEW_HISTORY : VIEW_TEXT);
+    break;
+  case ACTION_PAGE_HISTORY:
+    if (!historyView.pageBack())
+    {
+      historyView.begin(); // Past the oldest page, back to the newest
     }
+    break;
+  case ACTION_CALIBRATE:
+    startCalibration();
+    break;
+  case ACTION_RECORD:
+    setRecording(!recorderRecording()); // Stops a recording whose flash failed as well
+    break;
+  case ACTION_NONE:
+    break;
+  }
+}
+
+void setRecording(bool on)
+{
+  if (on)
+  {
+    recorderStart();
+  }
+  else
+  {
+    recorderStop();
+  }
+  if (currentView != VIEW_HISTORY)
+  {
+    drawConnectionStatus();
   }
-  delay(1000); // Delay for 1 second
+}
+
+// Redraw the connection status in the bottom-left corner
+void drawConnectionStatus()
+{
+  if (recorderActive())
+  {
+    drawStatusMessage("Recording", TFT_WHITE, TFT_RED);
+  }
+  else if (deviceConnected)
+  {
+    drawStatusMessage("Connected", TFT_BLACK, TFT_GREEN);
+  }
+  else
+  {
+    drawStatusMessage("Disconnected", TFT_WHITE, TFT_RED);
+  }
+}
+
+// Keep text from the app in the history arena and bring it on screen
+void showReceivedText(const char *text, size_t length)
+{
+  messageHistory.push(text, length);
+  advertiserBroadcast(messageHistory.latest(), messageHistory.length(0));
+
+  if (currentView == VIEW_HISTORY)
+  {
+    historyView.messageAdded(); // Scrolls in on the next update
+  }
+  else if (currentView == VIEW_TEXT) // The telemetry view picks it up when switching back
+  {
+    showLatestMessage();
+  }
+}
+
+// Clear the main area and redraw the newest message with the current text size
+void showLatestMessage()
+{
+  tft.fillRect(0, 0, tft.width(), tft.height() - 20, TFT_BLACK); // Clear screen, excluding bottom area
+  tft.setTextSize(textSize);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  drawWrappedText(messageHistory.latest(), 10, 20);
 }
 
 // Helper function to display a small status message in the bottom-left corner
@@ -386,36 +998,16 @@ void displayStatusMessage(const char *message, uint16_t textColor, uint16_t bgCo
 }
 
 // Full definition of drawWrappedText function
+// Text is UTF-8 and drawn from the glyph atlas at the current tft text size and colors
 void drawWrappedText(const char *text, int x, int y)
 {
-  int cursorX = x;
-  int cursorY = y;
-  int screenWidth = tft.width();   // Full width of the screen
-  int screenHeight = tft.height(); // Full height of the screen
-
-  for (int i = 0; text[i] != '\0'; i++)
-  {
-    // Create a temporary string with the single character for width calculation
-    char tempStr[2] = {text[i], '\0'}; // Null-terminate the string
-
-    // Check if the text width exceeds the screen width, wrap to the next line
-    if (cursorX + tft.textWidth(tempStr) > screenWidth)
-    {
-      cursorX = x;                 // Reset X position to the beginning
-      cursorY += tft.fontHeight(); // Move to the next line
-    }
-
-    // Check if the cursorY exceeds the screen height, wrap back to the top
-    if (cursorY + tft.fontHeight() > screenHeight)
-    {
-      cursorY = y;               // Reset Y position to the top
-      tft.fillScreen(TFT_BLACK); // Optionally, clear the screen when wrapping vertically
-    }
-
-    // Draw the character
-    tft.drawChar(text[i], cursorX, cursorY);
-
-    // Move to the next character position horizontally
-    cursorX += tft.textWidth(tempStr);
-  }
+  // Wraps at the screen edges, the layout itself is in TextLayout.h
+  layoutWrapped(text, x, y, tft.width(), tft.height(), glyphWidth(tft.textsize), glyphHeight(tft.textsize),
+                [](uint32_t codepoint, int cursorX, int cursorY, bool clear) {
+                  if (clear)
+                  {
+                    tft.fillScreen(TFT_BLACK); // Wrapped back to the top
+                  }
+                  drawGlyph(tft, codepoint, cursorX, cursorY, tft.textsize, tft.textcolor, tft.textbgcolor);
+                });
 }
@@ -0,0 +1,127 @@
+// Host decoder for the letters the glove broadcasts in its advertising data.
+//
+//   advdecode [capture.txt]      (reads stdin without an argument)
+//
+// One advertising report per line: the receive time in microseconds, the
+// advertiser's address and the raw advertising data in hex, e.g.
+// "1699999123456 24:0a:c4:12:34:56 020106...". Lines starting with '#' are ignored.
+// Prints each new letter update once per glove, then how many reports and
+// updates were seen and how many updates were missed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <map>
+#include "BroadcastFormat.h"
+
+struct Glove
+{
+  int lastSequence = -1;
+  unsigned long reports = 0;
+  unsigned long updates = 0;
+  unsigned long missed = 0; // Sequence numbers skipped between two received updates
+  unsigned long long firstUs = 0;
+  unsigned long long lastUs = 0;
+};
+
+static size_t parseHex(const char *text, uint8_t *out, size_t capacity)
+{
+  size_t length = 0;
+  unsigned value;
+  while (length < capacity && sscanf(text, "%2x", &value) == 1)
+  {
+    out[length++] = (uint8_t)value;
+    text += 2;
+  }
+  return length;
+}
+
+// Find the manufacturer specific AD structure in the advertising data
+static bool findManufacturerData(const uint8_t *data, size_t length, const uint8_t **field, size_t *fieldLength)
+{
+  size_t at = 0;
+  while (at < length && data[at] != 0)
+  {
+    size_t size = data[at];
+    if (at + 1 + size > length)
+    {
+      return false; // Truncated report
+    }
+    if (data[at + 1] == AD_TYPE_MANUFACTURER)
+    {
+      *field = data + at + 2;
+      *fieldLength = size - 1;
+      return true;
+    }
+    at += 1 + size;
+  }
+  return false;
+}
+
+int main(int argc, char **argv)
+{
+  FILE *input = stdin;
+  if (argc > 1 && !(input = fopen(argv[1], "r")))
+  {
+    fprintf(stderr, "advdecode: cannot open %s\n", argv[1]);
+    return 1;
+  }
+
+  std::map<std::string, Glove> gloves;
+  char line[512];
+  while (fgets(line, sizeof(line), input))
+  {
+    unsigned long long timeUs;
+    char address[32];
+    char hex[256];
+    if (line[0] == '#' || sscanf(line, "%llu %31s %255s", &timeUs, address, hex) != 3)
+    {
+      continue;
+    }
+    uint8_t data[128];
+    size_t length = parseHex(hex, data, sizeof(data));
+
+    const uint8_t *field;
+    size_t fieldLength;
+    uint8_t sequence;
+    const char *text;
+    size_t textLength;
+    if (!findManufacturerData(data, length, &field, &fieldLength) ||
+        !decodeBroadcast(field, fieldLength, &sequence, &text, &textLength))
+    {
+      continue; // Some other advertiser, or the glove in normal mode
+    }
+
+    Glove &glove = gloves[address];
+    if (glove.reports++ == 0)
+    {
+      glove.firstUs = timeUs;
+    }
+    glove.lastUs = timeUs;
+    if (sequence == glove.lastSequence)
+    {
+      continue; // Same payload advertised again
+    }
+    if (glove.lastSequence >= 0)
+    {
+      glove.missed += (uint8_t)(sequence - glove.lastSequence - 1);
+    }
+    glove.lastSequence = sequence;
+    glove.updates++;
+    printf("%12.3f s  %s  #%-3u %.*s\n", timeUs / 1e6, address, sequence, (int)textLength, text);
+  }
+  if (input != stdin)
+  {
+    fclose(input);
+  }
+
+  for (const auto &entry : gloves)
+  {
+    const Glove &g = entry.second;
+    double seconds = (g.lastUs - g.firstUs) / 1e6;
+    printf("%s: %lu reports (%.1f/s), %lu updates, %lu missed\n", entry.first.c_str(), g.reports,
+           seconds > 0 ? g.reports / seconds : 0.0, g.updates, g.missed);
+  }
+  return 0;
+}
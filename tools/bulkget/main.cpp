@@ -0,0 +1,540 @@
+// Host side of the recording download (see BulkTransfer.h).
+//
+//   bulkget sim <recording.rec | random:BYTES> <out> [loss=PCT] [mtu=N] [window=N] [packets=N] [cut=PCT]
+//   bulkget capture <capture.txt> <out>
+//
+// `sim` downloads through a simulated GATT link: a glove built from the same
+// BulkSender serves the file, connection events every 7.5 ms carry up to
+// `packets` notifications each and `loss` percent of them are dropped. `cut`
+// disconnects once that share of the file arrived and resumes from the saved
+// offset. The result is compared with the source and the throughput with what
+// the link could carry.
+//
+// `capture` reassembles a download from logged notifications, one per line as
+// the host receive time in microseconds and the message in hex, and reports
+// any ranges still missing.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "BulkTransfer.h"
+#include "RecordFormat.h"
+
+#define SIM_INTERVAL_US 7500      // Low latency connection profile
+#define SIM_STACK_QUEUE 10        // Notifications the glove keeps queued, BULK_MAX_IN_FLIGHT on the device
+#define SIM_IDLE_LIMIT_US 5000000 // Give up after this long without a notification
+#define SIM_RECORDING 1
+
+typedef std::vector<uint8_t> Bytes;
+
+// What the downloader needs from a GATT connection to the bulk characteristic
+class GattTransport
+{
+public:
+  virtual ~GattTransport() {}
+  virtual void write(const uint8_t *data, size_t length) = 0; // Write without response
+  virtual bool receive(Bytes *notification) = 0;              // False once the link is gone
+  virtual uint64_t nowUs() = 0;
+};
+
+static size_t sealBulk(uint8_t *buffer, size_t payloadLength)
+{
+  return sealMessage(buffer, PROTOCOL_MAX_MESSAGE, MSG_BULK, payloadLength);
+}
+
+// A glove serving one file and the radio between it and the host, advanced one connection event at a time
+class SimulatedGatt : public GattTransport
+{
+public:
+  SimulatedGatt(const Bytes &file, uint16_t mtu, int packets, double loss, uint32_t cutAt)
+      : file(file), mtu(mtu), packets(packets), loss(loss), cutAt(cutAt), now(0), delivered(0), dropped(0),
+        transferring(false), connected(true)
+  {
+  }
+
+  void write(const uint8_t *data, size_t length) override
+  {
+    toGlove.push_back(Bytes(data, data + length));
+  }
+
+  bool receive(Bytes *notification) override
+  {
+    uint64_t idleSince = now;
+    while (connected && toHost.empty())
+    {
+      connectionEvent();
+      if (now - idleSince > SIM_IDLE_LIMIT_US)
+      {
+        return false;
+      }
+    }
+    if (!connected)
+    {
+      return false;
+    }
+    *notification = toHost.front();
+    toHost.pop_front();
+    return true;
+  }
+
+  uint64_t nowUs() override { return now; }
+
+  void reconnect()
+  {
+    toGlove.clear();
+    toHost.clear();
+    stack.clear();
+    transferring = false;
+    connected = true;
+    now += 1000000; // About what the fast advertising burst takes to find the glove again
+  }
+
+  uint32_t droppedNotifications() const { return dropped; }
+  uint32_t resentBytes() const { return sender.resent(); }
+  uint16_t chunkSize() const { return bulkChunkSize(mtu - 3 - PROTOCOL_OVERHEAD); }
+
+private:
+  void notify(size_t payloadLength)
+  {
+    stack.push_back(Bytes(buffer, buffer + sealBulk(buffer, payloadLength)));
+  }
+
+  void handle(const Bytes &request)
+  {
+    Message message;
+    if (parseMessage(request.data(), request.size(), &message) != PROTOCOL_OK || message.type != MSG_BULK ||
+        message.length == 0)
+    {
+      return;
+    }
+    const uint8_t *args = message.payload + 1;
+    uint8_t *payload = messagePayload(buffer);
+    switch (message.payload[0])
+    {
+    case BULK_OPEN:
+      if (message.length != 8 || getLE(args, 2) != SIM_RECORDING)
+      {
+        payload[0] = BULK_ERROR;
+        payload[1] = message.length != 8 ? BULK_ERROR_BAD_REQUEST : BULK_ERROR_NOT_FOUND;
+        notify(2);
+        return;
+      }
+      sender.begin(file.size(), (uint32_t)getLE(args + 2, 4), args[6] ? args[6] : BULK_DEFAULT_WINDOW, chunkSize(),
+                   now / 1000);
+      transferring = true;
+      payload[0] = BULK_INFO;
+      putLE(payload + 1, SIM_RECORDING, 2);
+      putLE(payload + 3, file.size(), 4);
+      putLE(payload + 7, sender.ackedOffset(), 4);
+      putLE(payload + 11, chunkSize(), 2);
+      notify(13);
+      break;
+    case BULK_ACK:
+      if (transferring && message.length == 6)
+      {
+        sender.ack((uint32_t)getLE(args, 4), args[4], now / 1000);
+      }
+      break;
+    case BULK_CLOSE:
+      transferring = false;
+      break;
+    }
+  }
+
+  void pump()
+  {
+    uint32_t offset;
+    uint16_t length;
+    while (transferring && stack.size() < SIM_STACK_QUEUE && sender.next(&offset, &length, now / 1000))
+    {
+      uint8_t *payload = messagePayload(buffer);
+      payload[0] = BULK_DATA;
+      putLE(payload + 1, offset, 4);
+      memcpy(payload + BULK_DATA_HEADER, file.data() + offset, length);
+      notify(BULK_DATA_HEADER + length);
+      sender.sent(length);
+    }
+  }
+
+  void connectionEvent()
+  {
+    now += SIM_INTERVAL_US;
+    while (!toGlove.empty())
+    {
+      handle(toGlove.front());
+      toGlove.pop_front();
+    }
+    pump();
+    for (int i = 0; i < packets && !stack.empty(); i++)
+    {
+      Bytes notification = stack.front();
+      stack.pop_front();
+      if (rand() < loss * RAND_MAX)
+      {
+        dropped++; // Lost between the stack and the host, as when the controller's buffers overflow
+        continue;
+      }
+      delivered += notification.size();
+      toHost.push_back(notification);
+      if (cutAt && delivered >= cutAt)
+      {
+        cutAt = 0;
+        connected = false;
+        return;
+      }
+    }
+  }
+
+  const Bytes &file;
+  uint16_t mtu;
+  int packets;
+  double loss;
+  uint32_t cutAt; // Disconnect once this many bytes were delivered, 0 never
+  uint64_t now;
+  uint32_t delivered;
+  uint32_t dropped;
+  bool transferring;
+  bool connected;
+  BulkSender sender;
+  std::deque<Bytes> toGlove;
+  std::deque<Bytes> toHost;
+  std::deque<Bytes> stack;
+  uint8_t buffer[PROTOCOL_MAX_MESSAGE];
+};
+
+struct DownloadStats
+{
+  uint32_t acks;
+  uint32_t rewinds;
+  uint32_t ignored; // Chunks out of order or seen before
+};
+
+// Download recording `number` into `out` from `offset` on. Returns the offset
+// reached, the whole size when complete.
+static uint32_t download(GattTransport &gatt, uint16_t number, uint32_t offset, uint8_t window, Bytes *out,
+                         DownloadStats *stats)
+{
+  uint8_t request[PROTOCOL_MAX_MESSAGE];
+  uint8_t *args = messagePayload(request);
+  args[0] = BULK_OPEN;
+  putLE(args + 1, number, 2);
+  putLE(args + 3, offset, 4);
+  args[7] = window;
+  Bytes open(request, request + sealBulk(request, 8));
+  gatt.write(open.data(), open.size());
+  uint64_t openedAt = gatt.nowUs();
+
+  BulkReceiver receiver;
+  bool opened = false;
+  Bytes notification;
+  while (gatt.receive(&notification))
+  {
+    if (!opened && gatt.nowUs() - openedAt >= BULK_TIMEOUT_MS * 1000ull)
+    {
+      gatt.write(open.data(), open.size()); // The INFO answer was lost
+      openedAt = gatt.nowUs();
+    }
+
+    Message message;
+    if (parseMessage(notification.data(), notification.size(), &message) != PROTOCOL_OK ||
+        message.type != MSG_BULK || message.length == 0)
+    {
+      continue;
+    }
+    const uint8_t *payload = message.payload;
+    if (payload[0] == BULK_ERROR && message.length == 2)
+    {
+      fprintf(stderr, "bulkget: glove answered error %u\n", payload[1]);
+      return offset;
+    }
+    if (payload[0] == BULK_INFO && message.length == 13)
+    {
+      uint32_t size = (uint32_t)getLE(payload + 3, 4);
+      out->resize(size);
+      receiver.begin(size, (uint32_t)getLE(payload + 7, 4), window);
+      opened = true;
+    }
+    else if (opened && payload[0] == BULK_DATA && message.length > BULK_DATA_HEADER)
+    {
+      uint32_t at = (uint32_t)getLE(payload + 1, 4);
+      uint16_t length = message.length - BULK_DATA_HEADER;
+      if (at + length <= out->size() && receiver.accept(at, length))
+      {
+        memcpy(out->data() + at, payload + BULK_DATA_HEADER, length);
+      }
+      else
+      {
+        stats->ignored++;
+      }
+    }
+    else
+    {
+      continue;
+    }
+
+    uint32_t ackOffset;
+    uint8_t flags;
+    if (opened && receiver.ackDue(&ackOffset, &flags))
+    {
+      args[0] = BULK_ACK;
+      putLE(args + 1, ackOffset, 4);
+      args[5] = flags;
+      gatt.write(request, sealBulk(request, 6));
+      stats->acks++;
+      stats->rewinds += (flags & BULK_ACK_REWIND) != 0;
+    }
+    if (opened && receiver.done())
+    {
+      args[0] = BULK_CLOSE;
+      gatt.write(request, sealBulk(request, 1));
+      break;
+    }
+  }
+  return opened ? receiver.received() : offset;
+}
+
+static bool readFile(const char *path, Bytes *out)
+{
+  if (strncmp(path, "random:", 7) == 0)
+  {
+    out->resize(strtoul(path + 7, NULL, 10));
+    for (uint8_t &byte : *out)
+    {
+      byte = (uint8_t)rand();
+    }
+    return true;
+  }
+  FILE *input = fopen(path, "rb");
+  if (!input)
+  {
+    return false;
+  }
+  uint8_t block[4096];
+  size_t n;
+  while ((n = fread(block, 1, sizeof(block), input)) > 0)
+  {
+    out->insert(out->end(), block, block + n);
+  }
+  fclose(input);
+  return true;
+}
+
+static bool writeFile(const char *path, const Bytes &data)
+{
+  FILE *output = fopen(path, "wb");
+  if (!output)
+  {
+    return false;
+  }
+  bool ok = fwrite(data.data(), 1, data.size(), output) == data.size();
+  return fclose(output) == 0 && ok;
+}
+
+// Count the segments that pass their CRC, when the file is a recording
+static void reportSegments(const Bytes &data)
+{
+  if (data.size() < RECORD_SEGMENT_SIZE || data.size() % RECORD_SEGMENT_SIZE != 0)
+  {
+    return;
+  }
+  size_t ok = 0;
+  uint32_t frames = 0;
+  for (size_t at = 0; at < data.size(); at += RECORD_SEGMENT_SIZE)
+  {
+    SegmentHeader header;
+    if (readSegmentHeader(data.data() + at, &header) == SEGMENT_OK)
+    {
+      ok++;
+      frames += header.frameCount;
+    }
+  }
+  printf("segments         %zu of %zu valid, %u frames\n", ok, data.size() / RECORD_SEGMENT_SIZE, frames);
+}
+
+static int simulate(int argc, char **argv)
+{
+  double loss = 0;
+  int mtu = 247;
+  int window = BULK_DEFAULT_WINDOW;
+  int packets = 4;
+  double cut = 0;
+  for (int i = 4; i < argc; i++)
+  {
+    if (sscanf(argv[i], "loss=%lf", &loss) != 1 && sscanf(argv[i], "mtu=%d", &mtu) != 1 &&
+        sscanf(argv[i], "window=%d", &window) != 1 && sscanf(argv[i], "packets=%d", &packets) != 1 &&
+        sscanf(argv[i], "cut=%lf", &cut) != 1)
+    {
+      fprintf(stderr, "bulkget: unknown option %s\n", argv[i]);
+      return 1;
+    }
+  }
+  if (mtu < 23 || mtu > 517 || window < 1 || window > BULK_MAX_WINDOW || packets < 1)
+  {
+    fprintf(stderr, "bulkget: mtu 23..517, window 1..%d, packets at least 1\n", BULK_MAX_WINDOW);
+    return 1;
+  }
+
+  Bytes source;
+  if (!readFile(argv[2], &source))
+  {
+    fprintf(stderr, "bulkget: cannot read %s\n", argv[2]);
+    return 1;
+  }
+  SimulatedGatt gatt(source, (uint16_t)mtu, packets, loss / 100, (uint32_t)(source.size() * cut / 100));
+
+  Bytes received;
+  DownloadStats stats = {0, 0, 0};
+  uint32_t offset = 0;
+  int connections = 0;
+  while (connections < 10)
+  {
+    connections++;
+    offset = download(gatt, SIM_RECORDING, offset, (uint8_t)window, &received, &stats);
+    if (offset >= source.size())
+    {
+      break;
+    }
+    gatt.reconnect(); // Resume where the last connection stopped
+  }
+
+  bool same = received == source;
+  if (!writeFile(argv[3], received))
+  {
+    fprintf(stderr, "bulkget: cannot write %s\n", argv[3]);
+    return 1;
+  }
+  double seconds = gatt.nowUs() / 1e6;
+  double linkLimit = (double)packets * gatt.chunkSize() / (SIM_INTERVAL_US / 1e6);
+  printf("file             %zu bytes, %s\n", source.size(), same ? "identical" : "DIFFERENT");
+  printf("link             mtu %d, %u B chunks, %d per %.1f ms event, window %d, %.1f%% loss\n", mtu,
+         gatt.chunkSize(), packets, SIM_INTERVAL_US / 1000.0, window, loss);
+  printf("time             %.3f s simulated over %d connection%s\n", seconds, connections,
+         connections == 1 ? "" : "s");
+  printf("throughput       %.1f kB/s, link limit %.1f kB/s (%.0f%%)\n", source.size() / seconds / 1000,
+         linkLimit / 1000, 100.0 * source.size() / seconds / linkLimit);
+  printf("recovery         %u notifications dropped, %u bytes resent, %u acks, %u rewinds, %u chunks ignored\n",
+         gatt.droppedNotifications(), gatt.resentBytes(), stats.acks, stats.rewinds, stats.ignored);
+  reportSegments(received);
+  return same ? 0 : 2;
+}
+
+static size_t parseHex(const char *text, uint8_t *out, size_t capacity)
+{
+  size_t length = 0;
+  while (text[0] && text[1] && length < capacity)
+  {
+    if (text[0] == ' ' || text[0] == '\n' || text[0] == '\r')
+    {
+      text++;
+      continue;
+    }
+    unsigned value;
+    if (sscanf(text, "%2x", &value) != 1)
+    {
+      break;
+    }
+    out[length++] = (uint8_t)value;
+    text += 2;
+  }
+  return length;
+}
+
+static int reassemble(char **argv)
+{
+  FILE *input = fopen(argv[2], "r");
+  if (!input)
+  {
+    fprintf(stderr, "bulkget: cannot open %s\n", argv[2]);
+    return 1;
+  }
+  Bytes data;
+  std::vector<bool> have;
+  unsigned long corrupt = 0;
+  char line[2 * PROTOCOL_MAX_MESSAGE + 32];
+  while (fgets(line, sizeof(line), input))
+  {
+    if (line[0] == '#')
+    {
+      continue;
+    }
+    char *hex;
+    strtoull(line, &hex, 10);
+    uint8_t buffer[PROTOCOL_MAX_MESSAGE];
+    Message message;
+    if (parseMessage(buffer, parseHex(hex, buffer, sizeof(buffer)), &message) != PROTOCOL_OK)
+    {
+      corrupt++;
+      continue;
+    }
+    if (message.type != MSG_BULK || message.length == 0)
+    {
+      continue;
+    }
+    if (message.payload[0] == BULK_INFO && message.length == 13)
+    {
+      uint32_t size = (uint32_t)getLE(message.payload + 3, 4);
+      data.resize(size);
+      have.resize(size, false);
+    }
+    else if (message.payload[0] == BULK_DATA && message.length > BULK_DATA_HEADER)
+    {
+      uint32_t at = (uint32_t)getLE(message.payload + 1, 4);
+      size_t length = message.length - BULK_DATA_HEADER;
+      if (at + length > data.size())
+      {
+        corrupt++;
+        continue;
+      }
+      memcpy(data.data() + at, message.payload + BULK_DATA_HEADER, length);
+      std::fill(have.begin() + at, have.begin() + at + length, true);
+    }
+  }
+  fclose(input);
+
+  size_t missing = 0;
+  for (size_t at = 0; at < have.size();)
+  {
+    if (have[at])
+    {
+      at++;
+      continue;
+    }
+    size_t end = at;
+    while (end < have.size() && !have[end])
+    {
+      end++;
+    }
+    printf("missing          %zu..%zu\n", at, end - 1);
+    missing += end - at;
+    at = end;
+  }
+  printf("file             %zu bytes, %zu missing, %lu corrupt lines\n", data.size(), missing, corrupt);
+  reportSegments(data);
+  if (!writeFile(argv[3], data))
+  {
+    fprintf(stderr, "bulkget: cannot write %s\n", argv[3]);
+    return 1;
+  }
+  return missing == 0 && !data.empty() ? 0 : 2;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc >= 4 && strcmp(argv[1], "sim") == 0)
+  {
+    return simulate(argc, argv);
+  }
+  if (argc == 4 && strcmp(argv[1], "capture") == 0)
+  {
+    return reassemble(argv);
+  }
+  fprintf(stderr, "usage: bulkget sim <recording.rec | random:BYTES> <out> [loss=PCT] [mtu=N] [window=N] "
+                  "[packets=N] [cut=PCT]\n"
+                  "       bulkget capture <capture.txt> <out>\n");
+  return 1;
+}
@@ -0,0 +1,204 @@
+// Compression ratio and speed of the coded frame stream (FrameCodec.h), CSV on stdout.
+//
+//   codecbench [recording.rec ...]
+//
+// Every recording, or without arguments synthetic traces at 100 to 1000 Hz,
+// is coded in blocks of 1, 2, 4 and 8 frames (the notification batch sizes),
+// decoded again and checked frame by frame against the input. Sequence
+// numbers count the frames, as on a session that gets every one.
+//
+//   bytes_per_frame   block bytes per frame, headers included (MSG_FRAME: 28)
+//   ratio             MSG_FRAME payload bytes over coded bytes
+//   notify_ratio      the same for whole notifications, protocol overhead included
+//   stored_pct        blocks sent as they are because coding didn't pay
+//   encode_ns, decode_ns  per frame, on this host; see the codec_* microbench
+//                     kernels for cycles on the glove
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "GloveProtocol.h"
+#include "FrameCodec.h"
+#include "NotifyPacer.h"
+#include "GloveCalibration.h"
+#include "GestureTrace.h"
+#include "RecordReader.h"
+
+#define SYNTHETIC_SECONDS 60
+#define TIMED_FRAMES 1000000 // Frames coded per timing, the trace repeats until there are this many
+
+static const int blockSizes[] = {1, 2, 4, 8};
+
+static std::vector<CodecFrame> readRecording(const char *path)
+{
+  std::vector<CodecFrame> frames;
+  RecordingFile file;
+  if (!file.open(path))
+  {
+    fprintf(stderr, "codecbench: cannot read %s\n", path);
+    return frames;
+  }
+  FrameCursor cursor(file);
+  RecordedFrame recorded;
+  while (cursor.next(&recorded))
+  {
+    CodecFrame frame;
+    memcpy(frame.values, recorded.values, sizeof(frame.values));
+    frame.sequence = (uint16_t)frames.size();
+    frame.captureUs = (uint32_t)recorded.timeUs;
+    frames.push_back(frame);
+  }
+  return frames;
+}
+
+static std::vector<CodecFrame> synthesize(float rateHz)
+{
+  TraceConfig config = traceDefaults(1, "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG ");
+  config.rateHz = rateHz;
+  config.vcc = Glove::vcc;
+  config.rDiv = Glove::rDiv;
+  config.flatResistance = Glove::flatResistance;
+  config.bendResistance = Glove::bendResistance;
+  GestureTrace trace;
+  trace.begin(config);
+
+  std::vector<CodecFrame> frames((size_t)(rateHz * SYNTHETIC_SECONDS));
+  SensorSample sample;
+  for (size_t i = 0; i < frames.size(); i++)
+  {
+    trace.next(&sample);
+    Glove::flexAngles(sample.raw, frames[i].values);
+    traceImuToFrame(sample, frames[i].values);
+    frames[i].sequence = (uint16_t)i;
+    frames[i].captureUs = sample.timeUs;
+  }
+  return frames;
+}
+
+struct CodedTrace
+{
+  std::vector<uint8_t> bytes;
+  std::vector<size_t> blockEnds;
+  size_t storedBlocks = 0;
+};
+
+static void encodeAll(const std::vector<CodecFrame> &frames, int blockSize, CodedTrace *coded)
+{
+  FrameEncoder encoder;
+  uint8_t block[CODEC_MAX_BLOCK(PACER_MAX_BATCH)];
+  coded->bytes.clear();
+  coded->blockEnds.clear();
+  coded->storedBlocks = 0;
+  for (size_t at = 0; at < frames.size(); at += blockSize)
+  {
+    int count = (int)std::min(frames.size() - at, (size_t)blockSize);
+    size_t length = encoder.encode(&frames[at], count, block, sizeof(block));
+    coded->bytes.insert(coded->bytes.end(), block, block + length);
+    coded->blockEnds.push_back(coded->bytes.size());
+    coded->storedBlocks += (block[0] & CODEC_STORED) != 0;
+  }
+}
+
+// Frames decoded, or -1 on the first block that fails
+static long decodeAll(const CodedTrace &coded, CodecFrame *out)
+{
+  FrameDecoder decoder;
+  long decoded = 0;
+  size_t start = 0;
+  for (size_t end : coded.blockEnds)
+  {
+    int count;
+    if (decoder.decode(&coded.bytes[start], end - start, out + decoded, PACER_MAX_BATCH, &count) != CODEC_OK)
+    {
+      return -1;
+    }
+    decoded += count;
+    start = end;
+  }
+  return decoded;
+}
+
+static bool sameFrame(const CodecFrame &a, const CodecFrame &b)
+{
+  return memcmp(a.values, b.values, sizeof(a.values)) == 0 && a.sequence == b.sequence &&
+         a.captureUs == b.captureUs;
+}
+
+template <typename F>
+static double nsPerFrame(size_t frames, F run)
+{
+  int repeats = (int)(TIMED_FRAMES / frames) + 1;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++)
+  {
+    run();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / ((double)repeats * frames);
+}
+
+static bool bench(const char *source, const std::vector<CodecFrame> &frames)
+{
+  if (frames.size() < 2)
+  {
+    fprintf(stderr, "codecbench: %s has too few frames\n", source);
+    return false;
+  }
+  double rateHz = (frames.size() - 1) * 1e6 / (uint32_t)(frames.back().captureUs - frames.front().captureUs);
+  std::vector<CodecFrame> decoded(frames.size());
+  CodedTrace coded;
+  for (int blockSize : blockSizes)
+  {
+    encodeAll(frames, blockSize, &coded);
+    long count = decodeAll(coded, decoded.data());
+    if (count != (long)frames.size())
+    {
+      fprintf(stderr, "codecbench: %s, blocks of %d: %ld of %zu frames decoded\n", source, blockSize, count,
+              frames.size());
+      return false;
+    }
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+      if (!sameFrame(frames[i], decoded[i]))
+      {
+        fprintf(stderr, "codecbench: %s, blocks of %d: frame %zu differs\n", source, blockSize, i);
+        return false;
+      }
+    }
+
+    CodedTrace timed;
+    double encodeNs = nsPerFrame(frames.size(), [&] { encodeAll(frames, blockSize, &timed); });
+    double decodeNs = nsPerFrame(frames.size(), [&] { decodeAll(coded, decoded.data()); });
+
+    size_t blocks = coded.blockEnds.size();
+    double bytesPerFrame = (double)coded.bytes.size() / frames.size();
+    double notifyRaw = (double)blocks * PROTOCOL_OVERHEAD + (double)frames.size() * FRAME_PAYLOAD_SIZE;
+    double notifyCoded = (double)blocks * PROTOCOL_OVERHEAD + coded.bytes.size();
+    printf("%s,%.0f,%d,%zu,%.2f,%.2f,%.2f,%.1f,%.0f,%.0f\n", source, rateHz, blockSize, frames.size(),
+           bytesPerFrame, FRAME_PAYLOAD_SIZE / bytesPerFrame, notifyRaw / notifyCoded,
+           100.0 * coded.storedBlocks / blocks, encodeNs, decodeNs);
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  printf("source,rate_hz,block,frames,bytes_per_frame,ratio,notify_ratio,stored_pct,encode_ns,decode_ns\n");
+  bool ok = true;
+  if (argc < 2)
+  {
+    const float rates[] = {100, 250, 500, 1000};
+    for (float rate : rates)
+    {
+      ok &= bench("synthetic", synthesize(rate));
+    }
+  }
+  for (int i = 1; i < argc; i++)
+  {
+    ok &= bench(argv[i], readRecording(argv[i]));
+  }
+  return ok ? 0 : 1;
+}
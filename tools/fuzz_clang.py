@@ -0,0 +1,12 @@
+"""PlatformIO pre-build script for the native fuzz_* environments.
+
+libFuzzer only ships with clang, so the host compiler is swapped for it and
+the sanitizers from build_flags are passed to the linker as well.
+"""
+
+Import("env")  # noqa: F821 - provided by SCons when run by PlatformIO
+
+SANITIZERS = "-fsanitize=fuzzer,address,undefined"
+
+env.Replace(CC="clang", CXX="clang++", LINK="clang++")  # noqa: F821
+env.Append(LINKFLAGS=[SANITIZERS])  # noqa: F821
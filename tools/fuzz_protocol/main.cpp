@@ -0,0 +1,366 @@
+// libFuzzer target for the decoders that read bytes from the air (GloveProtocol.h).
+//
+//   pio run -e fuzz_protocol, then .pio/build/fuzz_protocol/program [corpus/]
+//
+// The first input byte picks a decoder, the rest is its input. Besides
+// memory errors (address and undefined behaviour sanitizers), every input a
+// decoder accepts must encode back to the same bytes, and every payload
+// sealed must parse back unchanged.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "PackedFrame.h"
+#include "FrameCodec.h"
+#include "BroadcastFormat.h"
+#include "RecordFormat.h"
+
+#define FUZZ_CHECK(condition)                                                \
+  do                                                                         \
+  {                                                                          \
+    if (!(condition))                                                        \
+    {                                                                        \
+      fprintf(stderr, "%s:%d: %s failed\n", __FILE__, __LINE__, #condition); \
+      abort();                                                               \
+    }                                                                        \
+  } while (0)
+
+// A message that parses seals back to the same bytes
+static void fuzzParse(const uint8_t *data, size_t size)
+{
+  Message message;
+  if (parseMessage(data, size, &message) != PROTOCOL_OK)
+  {
+    return;
+  }
+  FUZZ_CHECK(message.payload == data + PROTOCOL_HEADER_SIZE);
+  FUZZ_CHECK(message.length <= PROTOCOL_MAX_PAYLOAD);
+
+  static uint8_t sealed[PROTOCOL_MAX_MESSAGE];
+  memcpy(messagePayload(sealed), message.payload, message.length);
+  size_t length = sealMessage(sealed, sizeof(sealed), (MessageType)message.type, message.length);
+  FUZZ_CHECK(length == size);
+  FUZZ_CHECK(memcmp(sealed, data, size) == 0);
+}
+
+// Any payload sealed parses back as it was, the first byte is the type
+static void fuzzSeal(const uint8_t *data, size_t size)
+{
+  if (size < 1)
+  {
+    return;
+  }
+  static uint8_t buffer[PROTOCOL_MAX_MESSAGE];
+  size_t payloadLength = size - 1;
+  memcpy(messagePayload(buffer), data + 1, payloadLength > PROTOCOL_MAX_PAYLOAD ? 0 : payloadLength);
+  size_t length = sealMessage(buffer, sizeof(buffer), (MessageType)data[0], payloadLength);
+  if (payloadLength > PROTOCOL_MAX_PAYLOAD)
+  {
+    FUZZ_CHECK(length == 0);
+    return;
+  }
+  FUZZ_CHECK(length == payloadLength + PROTOCOL_OVERHEAD);
+
+  Message message;
+  FUZZ_CHECK(parseMessage(buffer, length, &message) == PROTOCOL_OK);
+  FUZZ_CHECK(message.type == data[0]);
+  FUZZ_CHECK(message.length == payloadLength);
+  FUZZ_CHECK(memcmp(message.payload, data + 1, payloadLength) == 0);
+
+  // A single flipped bit anywhere is caught
+  buffer[data[0] % length] ^= 1 << (payloadLength % 8);
+  FUZZ_CHECK(parseMessage(buffer, length, &message) != PROTOCOL_OK);
+}
+
+static void fuzzFrame(const uint8_t *data, size_t size)
+{
+  int16_t values[FRAME_VALUES];
+  uint16_t sequence;
+  uint32_t captureUs;
+  if (!decodeFrame(data, size, values, &sequence, &captureUs))
+  {
+    return;
+  }
+  uint8_t frame[FRAME_PAYLOAD_SIZE];
+  FUZZ_CHECK(encodeFrame(values, sequence, captureUs, frame) == size);
+  FUZZ_CHECK(memcmp(frame, data, size) == 0);
+}
+
+// A packed frame repacks to the same bytes, bar the unused high bits of the last byte
+static void fuzzPacked(const uint8_t *data, size_t size)
+{
+  int16_t values[FRAME_VALUES];
+  uint16_t sequence;
+  uint32_t captureUs;
+  if (!unpackFrame(data, size, values, &sequence, &captureUs))
+  {
+    return;
+  }
+  uint8_t packed[PACKED_FRAME_SIZE];
+  FUZZ_CHECK(packFrame(values, sequence, captureUs, packed) == size);
+  FUZZ_CHECK(memcmp(packed, data, size - 1) == 0);
+  uint8_t used = PACKED_FRAME_BITS % 8 ? (1 << (PACKED_FRAME_BITS % 8)) - 1 : 0xFF;
+  FUZZ_CHECK(packed[size - 1] == (data[size - 1] & used));
+}
+
+// Any frame packs to values within half a step of its own, or the end of the
+// field's range, and packing what unpacks gives the same bytes again
+static void fuzzPackedRoundTrip(const uint8_t *data, size_t size)
+{
+  int16_t values[FRAME_VALUES];
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    values[i] = (size_t)(2 * i + 2) <= size ? (int16_t)getLE(data + 2 * i, 2) : 0;
+  }
+  uint16_t sequence = (uint16_t)size;
+  uint32_t captureUs = size >= 4 ? (uint32_t)getLE(data + size - 4, 4) : 0;
+  uint8_t packed[PACKED_FRAME_SIZE];
+  FUZZ_CHECK(packFrame(values, sequence, captureUs, packed) == PACKED_FRAME_SIZE);
+
+  int16_t unpacked[FRAME_VALUES];
+  uint16_t unpackedSequence;
+  uint32_t unpackedUs;
+  FUZZ_CHECK(unpackFrame(packed, sizeof(packed), unpacked, &unpackedSequence, &unpackedUs));
+  FUZZ_CHECK(unpackedSequence == (sequence & (packedSpan(0) - 1)));
+  FUZZ_CHECK(unpackedUs == (captureUs & (packedSpan(1) - 1) & ~((1u << packedLayout.field[1].shift) - 1)));
+  for (int i = 0; i < FRAME_VALUES; i++)
+  {
+    const PackedField &field = packedLayout.field[i + 2];
+    int32_t low = field.kind == PACKED_SIGNED ? -(1 << (field.bits - 1)) : 0;
+    int32_t high = field.kind == PACKED_SIGNED ? (1 << (field.bits - 1)) - 1 : (1 << field.bits) - 1;
+    int32_t step = 1 << field.shift;
+    int32_t error = unpacked[i] - values[i]; // Ties round up, so in (-step / 2, step / 2]
+    bool saturated = unpacked[i] == low * step || unpacked[i] == high * step;
+    FUZZ_CHECK(saturated || (error > (step >> 1) - step && error <= (step >> 1)));
+  }
+
+  uint8_t repacked[PACKED_FRAME_SIZE];
+  FUZZ_CHECK(packFrame(unpacked, unpackedSequence, unpackedUs, repacked) == PACKED_FRAME_SIZE);
+  FUZZ_CHECK(memcmp(repacked, packed, sizeof(packed)) == 0);
+}
+
+// Blocks back to back for one decoder, each after a length byte, so its model
+// carries over from the blocks before like on a link
+static void fuzzCoded(const uint8_t *data, size_t size)
+{
+  static FrameDecoder decoder;
+  static CodecFrame frames[CODEC_MAX_FRAMES];
+  decoder.reset();
+  for (size_t at = 0; at < size;)
+  {
+    size_t length = data[at++];
+    length = length < size - at ? length : size - at;
+    int capacity = 1 + (int)(length % CODEC_MAX_FRAMES);
+    int count = -1;
+    if (decoder.decode(data + at, length, frames, capacity, &count) == CODEC_OK)
+    {
+      FUZZ_CHECK(count >= 1 && count <= capacity);
+    }
+    at += length;
+  }
+}
+
+// Frames made from the input, coded in blocks of sizes the input picks, decode back
+// unchanged. After a block that is dropped on the way the decoder waits for a key block.
+static void fuzzCodedRoundTrip(const uint8_t *data, size_t size)
+{
+  static FrameEncoder encoder;
+  static FrameDecoder decoder;
+  static CodecFrame frames[CODEC_MAX_FRAMES];
+  static CodecFrame decoded[CODEC_MAX_FRAMES];
+  static uint8_t block[CODEC_MAX_BLOCK(CODEC_MAX_FRAMES)];
+  encoder.reset();
+  decoder.reset();
+  bool synced = true;
+  size_t at = 0;
+  while (at < size)
+  {
+    uint8_t control = data[at++];
+    int count = 1 + control % 16;
+    for (int f = 0; f < count; f++)
+    {
+      CodecFrame &frame = frames[f];
+      for (int i = 0; i < FRAME_VALUES; i++, at += 2)
+      {
+        frame.values[i] = at + 2 <= size ? (int16_t)getLE(data + at, 2) : 0;
+      }
+      frame.sequence = (uint16_t)(f > 0 ? frames[f - 1].sequence + 1 : at);
+      frame.captureUs = f > 0 ? frames[f - 1].captureUs + (at < size ? data[at] * 100u : 2000u) : (uint32_t)at * 997u;
+    }
+    size_t length = encoder.encode(frames, count, block, sizeof(block));
+    FUZZ_CHECK(length >= CODEC_HEADER_SIZE && length <= (size_t)CODEC_MAX_BLOCK(count));
+
+    if (control & 0x80)
+    {
+      if (control & 0x40)
+      {
+        encoder.reset(); // A failed send, the next block is a key block
+      }
+      synced = false; // Otherwise missed by the central without the glove knowing
+      continue;
+    }
+    int decodedCount = 0;
+    CodecStatus status = decoder.decode(block, length, decoded, CODEC_MAX_FRAMES, &decodedCount);
+    if (!synced && !(block[0] & CODEC_KEY))
+    {
+      FUZZ_CHECK(status == CODEC_NEED_KEY);
+      continue;
+    }
+    FUZZ_CHECK(status == CODEC_OK);
+    FUZZ_CHECK(decodedCount == count);
+    for (int f = 0; f < count; f++)
+    {
+      FUZZ_CHECK(memcmp(decoded[f].values, frames[f].values, sizeof(frames[f].values)) == 0);
+      FUZZ_CHECK(decoded[f].sequence == frames[f].sequence);
+      FUZZ_CHECK(decoded[f].captureUs == frames[f].captureUs);
+    }
+    synced = true;
+  }
+}
+
+static void fuzzBroadcast(const uint8_t *data, size_t size)
+{
+  uint8_t sequence;
+  const char *text;
+  size_t textLength;
+  if (!decodeBroadcast(data, size, &sequence, &text, &textLength))
+  {
+    return;
+  }
+  FUZZ_CHECK((const uint8_t *)text == data + BROADCAST_HEADER_SIZE);
+  uint8_t encoded[BROADCAST_MAX_DATA];
+  FUZZ_CHECK(encodeBroadcast(sequence, text, textLength, encoded) == size);
+  FUZZ_CHECK(memcmp(encoded, data, size) == 0);
+}
+
+// Any text broadcasts as a tail that fits and starts on a character, and decodes to that tail
+static void fuzzBroadcastText(const uint8_t *data, size_t size)
+{
+  uint8_t encoded[BROADCAST_MAX_DATA];
+  size_t length = encodeBroadcast((uint8_t)size, (const char *)data, size, encoded);
+  FUZZ_CHECK(length <= BROADCAST_MAX_DATA);
+
+  uint8_t sequence;
+  const char *text;
+  size_t textLength;
+  FUZZ_CHECK(decodeBroadcast(encoded, length, &sequence, &text, &textLength));
+  FUZZ_CHECK(sequence == (uint8_t)size);
+  FUZZ_CHECK(textLength <= size && memcmp(text, data + size - textLength, textLength) == 0);
+  FUZZ_CHECK(textLength == size || textLength == 0 || ((uint8_t)text[0] & 0xC0) != 0x80);
+}
+
+// Every frame of a segment, the frame count checked against what was walked
+static void readSegment(const uint8_t *segment)
+{
+  SegmentReader reader;
+  if (reader.begin(segment) != SEGMENT_OK)
+  {
+    return;
+  }
+  int16_t values[FRAME_VALUES];
+  uint32_t captureUs;
+  uint16_t frames = 0;
+  while (reader.next(values, &captureUs))
+  {
+    frames++;
+  }
+  FUZZ_CHECK(frames + reader.remainingFrames() == reader.header().frameCount);
+}
+
+// A whole segment as read from flash, padded like erased flash
+static void fuzzSegment(const uint8_t *data, size_t size)
+{
+  static uint8_t segment[RECORD_SEGMENT_SIZE];
+  size = size < RECORD_SEGMENT_SIZE ? size : RECORD_SEGMENT_SIZE;
+  memcpy(segment, data, size);
+  memset(segment + size, 0xFF, RECORD_SEGMENT_SIZE - size);
+  readSegment(segment);
+}
+
+// Frame data behind a valid header and CRC, the part the CRC keeps random bytes out of
+static void fuzzSegmentData(const uint8_t *data, size_t size)
+{
+  if (size < 2)
+  {
+    return;
+  }
+  static uint8_t segment[RECORD_SEGMENT_SIZE];
+  size_t length = size - 2 < RECORD_SEGMENT_SIZE - RECORD_HEADER_SIZE ? size - 2 : RECORD_SEGMENT_SIZE - RECORD_HEADER_SIZE;
+  putLE(segment, RECORD_MAGIC, 4);
+  segment[4] = RECORD_VERSION;
+  segment[5] = FRAME_VALUES;
+  memcpy(segment + 6, data, 2); // Frame count
+  putLE(segment + 8, 0, 4);
+  putLE(segment + 12, 0, 4);
+  putLE(segment + 16, length, 2);
+  memcpy(segment + RECORD_HEADER_SIZE, data + 2, length);
+  putLE(segment + 18, crc16(segment + RECORD_HEADER_SIZE, length, crc16(segment, 18)), 2);
+  readSegment(segment);
+}
+
+// Frames made from the input are written to a segment and read back unchanged
+static void fuzzSegmentRoundTrip(const uint8_t *data, size_t size)
+{
+  static uint8_t segment[RECORD_SEGMENT_SIZE];
+  static int16_t written[RECORD_SEGMENT_SIZE][FRAME_VALUES];
+  static uint32_t writtenUs[RECORD_SEGMENT_SIZE];
+  SegmentWriter writer;
+  writer.begin(segment, (uint32_t)size);
+  int frames = 0;
+  uint32_t captureUs = 0;
+  for (size_t at = 0; at + 2 <= size; frames++)
+  {
+    for (int i = 0; i < FRAME_VALUES; i++, at += 2)
+    {
+      written[frames][i] = at + 2 <= size ? (int16_t)getLE(data + at, 2) : 0;
+    }
+    captureUs += at < size ? data[at] * data[at] * 1000u : 0; // Small and large steps alike
+    writtenUs[frames] = captureUs;
+    if (!writer.add(written[frames], captureUs))
+    {
+      break;
+    }
+  }
+  writer.seal();
+
+  SegmentReader reader;
+  FUZZ_CHECK(reader.begin(segment) == SEGMENT_OK);
+  FUZZ_CHECK(reader.header().frameCount == writer.frameCount());
+  int16_t values[FRAME_VALUES];
+  for (int i = 0; i < writer.frameCount(); i++)
+  {
+    FUZZ_CHECK(reader.next(values, &captureUs));
+    FUZZ_CHECK(memcmp(values, written[i], sizeof(values)) == 0);
+    FUZZ_CHECK(captureUs == writtenUs[i]);
+  }
+  FUZZ_CHECK(!reader.next(values, &captureUs));
+}
+
+typedef void (*FuzzTarget)(const uint8_t *data, size_t size);
+
+static const FuzzTarget targets[] = {
+    fuzzParse,
+    fuzzSeal,
+    fuzzFrame,
+    fuzzBroadcast,
+    fuzzBroadcastText,
+    fuzzSegment,
+    fuzzSegmentData,
+    fuzzSegmentRoundTrip,
+    fuzzPacked,
+    fuzzPackedRoundTrip,
+    fuzzCoded,
+    fuzzCodedRoundTrip,
+};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  if (size < 1)
+  {
+    return 0;
+  }
+  targets[data[0] % (sizeof(targets) / sizeof(targets[0]))](data + 1, size - 1);
+  return 0;
+}
@@ -0,0 +1,206 @@
+"""Rasterize a Unicode subset of a TrueType font into include/GlyphAtlas.h.
+
+One bitmap set is produced per text size, so the firmware only blits
+pre-rendered glyphs and never scales or rasterizes at runtime.
+
+Runs standalone:
+    python tools/generate_glyph_atlas.py --font DejaVuSansMono.ttf
+
+or as a PlatformIO pre-build script, configured from platformio.ini:
+    custom_glyph_font   = path to a .ttf (monospace recommended)
+    custom_glyph_ranges = 0x20-0x7E,0xA0-0x17F
+    custom_glyph_sizes  = 11,22   (font pixel size for text size 1, 2, ...)
+U+003F '?' is always included, the firmware draws it for missing glyphs.
+The header is only rewritten when the configuration changes, and the
+committed header is kept when Pillow or the font is not available.
+"""
+
+import argparse
+import hashlib
+import os
+import sys
+
+DEFAULT_FONT = "/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf"
+DEFAULT_RANGES = "0x20-0x7E,0xA0-0x17F,0x2013-0x2014,0x2018-0x201E,0x2022,0x2026,0x20AC"
+DEFAULT_SIZES = "11,22"
+THRESHOLD = 90  # Coverage (0-255) above which a pixel is set, low enough to keep thin strokes
+HEADER_NAME = "GlyphAtlas.h"
+FORMAT = 2  # Bumped whenever the header layout changes, so old headers are regenerated
+FALLBACK = 0x3F  # '?', drawn for codepoints the atlas lacks
+
+
+def parse_ranges(text):
+    codepoints = set()
+    for part in text.split(","):
+        part = part.strip()
+        if not part:
+            continue
+        if "-" in part:
+            first, last = part.split("-")
+            codepoints.update(range(int(first, 0), int(last, 0) + 1))
+        else:
+            codepoints.add(int(part, 0))
+    codepoints.add(FALLBACK)
+    return sorted(codepoints)
+
+
+def config_hash(font, ranges, sizes):
+    with open(font, "rb") as f:
+        digest = hashlib.sha1(f.read())
+    digest.update(ranges.encode())
+    digest.update(sizes.encode())
+    digest.update(str(THRESHOLD).encode())
+    digest.update(str(FORMAT).encode())
+    return digest.hexdigest()[:16]
+
+
+def rasterize(font_path, pixel_size, codepoints):
+    from PIL import Image, ImageDraw, ImageFont
+
+    font = ImageFont.truetype(font_path, pixel_size)
+    ascent, descent = font.getmetrics()
+    width = int(round(font.getlength("M")))
+    height = ascent + descent
+    stride = (width + 7) // 8
+
+    bitmaps = []
+    for cp in codepoints:
+        image = Image.new("L", (width, height), 0)
+        ImageDraw.Draw(image).text((0, 0), chr(cp), font=font, fill=255)
+        pixels = image.load()
+        rows = []
+        for y in range(height):
+            row = [0] * stride
+            for x in range(width):
+                if pixels[x, y] >= THRESHOLD:
+                    row[x // 8] |= 0x80 >> (x % 8)
+            rows.extend(row)
+        bitmaps.append(rows)
+    return width, height, stride, bitmaps
+
+
+def generate(font, ranges, sizes, output):
+    codepoints = parse_ranges(ranges)
+    pixel_sizes = [int(s) for s in sizes.split(",")]
+    tag = config_hash(font, ranges, sizes)
+
+    lines = [
+        "// Generated by   : tools/generate_glyph_atlas.py",
+        "// Generated from : %s" % os.path.basename(font),
+        "// Unicode ranges : %s" % ranges,
+        "// Pixel sizes    : %s" % sizes,
+        "// Config hash    : %s" % tag,
+        "",
+        "#ifndef GLYPH_ATLAS_H",
+        "#define GLYPH_ATLAS_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#if defined(__AVR__)",
+        "    #include <avr/pgmspace.h>",
+        "#elif !defined(PROGMEM)",
+        "    #define PROGMEM",
+        "#endif",
+        "",
+        "#define GLYPH_COUNT %d" % len(codepoints),
+        "#define GLYPH_SIZES %d" % len(pixel_sizes),
+        "",
+        "// Codepoints in ascending order, glyph i of every size belongs to glyphCodepoints[i]",
+        "const uint32_t glyphCodepoints[GLYPH_COUNT] PROGMEM = {",
+    ]
+    for i in range(0, len(codepoints), 12):
+        lines.append("  " + ", ".join("0x%04X" % cp for cp in codepoints[i:i + 12]) + ",")
+    lines.append("};")
+    lines.append("")
+
+    metrics = []
+    for index, pixel_size in enumerate(pixel_sizes):
+        width, height, stride, bitmaps = rasterize(font, pixel_size, codepoints)
+        if width > 255 or height > 255:
+            raise ValueError("pixel size %d gives a %dx%d cell, GlyphSet holds 255 at most"
+                             % (pixel_size, width, height))
+        metrics.append((width, height, stride, index))
+        lines.append("// Text size %d: %dx%d cells, %d bytes per row, MSB is the leftmost pixel"
+                     % (index + 1, width, height, stride))
+        lines.append("const uint8_t glyphBitmaps%d[GLYPH_COUNT * %d] PROGMEM = {"
+                     % (index + 1, stride * height))
+        for cp, rows in zip(codepoints, bitmaps):
+            lines.append("  " + ", ".join("0x%02X" % b for b in rows) + ",   // U+%04X" % cp)
+        lines.append("};")
+        lines.append("")
+
+    lines.insert(lines.index("#define GLYPH_SIZES %d" % len(pixel_sizes)) + 1,
+                 "#define GLYPH_MAX_CELL_PIXELS %d // Largest width x height of any size"
+                 % max(width * height for width, height, stride, index in metrics))
+
+    lines.append("struct GlyphSet")
+    lines.append("{")
+    lines.append("  uint8_t width;        // Cell advance in pixels")
+    lines.append("  uint8_t height;       // Cell height in pixels")
+    lines.append("  uint8_t stride;       // Bytes per bitmap row")
+    lines.append("  const uint8_t *bitmaps;")
+    lines.append("};")
+    lines.append("")
+    lines.append("const GlyphSet glyphSets[GLYPH_SIZES] = {")
+    for width, height, stride, index in metrics:
+        lines.append("  {%d, %d, %d, glyphBitmaps%d}," % (width, height, stride, index + 1))
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+
+    with open(output, "w") as f:
+        f.write("\n".join(lines))
+
+
+def existing_hash(output):
+    if not os.path.exists(output):
+        return None
+    with open(output) as f:
+        for line in f:
+            if line.startswith("// Config hash"):
+                return line.split(":")[1].strip()
+    return None
+
+
+def run_from_platformio(env):
+    project_dir = env.subst("$PROJECT_DIR")
+    font = env.GetProjectOption("custom_glyph_font", DEFAULT_FONT)
+    ranges = env.GetProjectOption("custom_glyph_ranges", DEFAULT_RANGES)
+    sizes = env.GetProjectOption("custom_glyph_sizes", DEFAULT_SIZES)
+    output = os.path.join(project_dir, "include", HEADER_NAME)
+
+    if not os.path.isabs(font):
+        font = os.path.join(project_dir, font)
+    if not os.path.exists(font):
+        print("*" * 72)
+        print("WARNING: glyph atlas font %s not found." % font)
+        print("Set custom_glyph_font in platformio.ini to a .ttf on this machine;")
+        print("until then the committed %s is used unchanged." % HEADER_NAME)
+        print("*" * 72)
+        return
+    if existing_hash(output) == config_hash(font, ranges, sizes):
+        return
+    try:
+        generate(font, ranges, sizes, output)
+        print("Glyph atlas: regenerated %s" % HEADER_NAME)
+    except ImportError:
+        print("Glyph atlas: Pillow not installed, keeping %s" % HEADER_NAME)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--font", default=DEFAULT_FONT)
+    parser.add_argument("--ranges", default=DEFAULT_RANGES)
+    parser.add_argument("--sizes", default=DEFAULT_SIZES)
+    parser.add_argument("--output", default=os.path.join(os.path.dirname(__file__), "..", "include", HEADER_NAME))
+    args = parser.parse_args()
+    generate(args.font, args.ranges, args.sizes, args.output)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by SCons when run by PlatformIO
+    run_from_platformio(env)  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        sys.exit(main())
@@ -0,0 +1,517 @@
+// Golden trace regression harness for the signal pipeline.
+//
+//   golden record <dir> [file.rec ...]   run every trace, store the outputs in <dir>
+//   golden check <dir> [file.rec ...]    run again and diff against <dir>, exit 1 on a difference
+//   golden variants                      how far each glove profile's calibration is from the truth
+//
+// Every trace goes through the same stages as on the glove, each timed:
+//
+//   convert  calibration, flex angles and IMU scaling (GlovePipeline)
+//   encode   MSG_FRAME messages in notification sized batches, parsed back (GloveProtocol)
+//   record   recording segments, read back (RecordFormat)
+//
+// The synthetic traces (GestureTrace.h) start from raw readings and run all
+// of it. Recordings passed on the command line already hold converted frames
+// and start at encode. Encoding must give back exactly what went in; the
+// outputs of the last stage are what's compared with the goldens, within
+// GOLDEN_FLEX_TOLERANCE and GOLDEN_IMU_TOLERANCE so a one count truncation
+// after a float change doesn't fail the check.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "GlovePipeline.h"
+#include "GloveCalibration.h"
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "GestureTrace.h"
+#include "RecordFormat.h"
+#include "RecordReader.h"
+
+#define GOLDEN_FLEX_TOLERANCE 1 // Degrees
+#define GOLDEN_IMU_TOLERANCE 1  // x100 units
+#define GOLDEN_BATCH 8          // Frames per MSG_FRAME, the pacer's largest batch
+
+struct SyntheticTrace
+{
+  const char *name;
+  uint32_t seed;
+  const char *text;
+  unsigned long frames;
+  bool clean;             // No noise, drift or dropouts
+  float dropoutsPerMin;   // 0 for the default rate
+};
+
+static const SyntheticTrace syntheticTraces[] = {
+    {"alphabet", 1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ ", 6000, true, 0},
+    {"pangram", 2, "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG ", 12000, false, 0},
+    {"dropouts", 3, "HELLO WORLD ", 6000, false, 60},
+};
+
+// The glove the synthetic traces come from: the divider and sensors as measured
+// when this harness was written. Deliberately not GloveCalibration.h, so a change
+// there shows up as a difference instead of being generated into the traces too.
+// A glove with more channels repeats the five measured sensors.
+#define TRACE_VCC 5.0
+#define TRACE_R_DIV 10000.0
+#define TRACE_SENSORS 5
+static const float measuredFlat[TRACE_SENSORS] = {54642.00, 57937.00, 44730.00, 60732.00, 48805.00};
+static const float measuredBend[TRACE_SENSORS] = {158494.00, 125896.00, 68138.00, 136138.00, 134915.00};
+static float traceFlat[FLEX_COUNT];
+static float traceBend[FLEX_COUNT];
+
+struct Calibration
+{
+  const char *name;
+  int flexCount; // Only compared on a build with the same channel count
+  void (*flexAngles)(const int *raw, int16_t *frame);
+};
+
+// The profile this build is for first, then the prototypes in Main Code
+static const Calibration calibrations[] = {
+    {"firmware", Glove::flexCount, Glove::flexAngles},
+    {GlovePrototype3V3::name, GlovePrototype3V3::flexCount, GloveProfile<GlovePrototype3V3>::flexAngles},
+    {GlovePrototype3V3R15k::name, GlovePrototype3V3R15k::flexCount, GloveProfile<GlovePrototype3V3R15k>::flexAngles},
+};
+
+struct Trace
+{
+  std::string name;
+  std::vector<SensorSample> samples; // Raw readings, synthetic traces only
+  std::vector<RecordedFrame> frames; // Converted frames
+};
+
+struct Timings
+{
+  double convert, encode, record;
+};
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void generate(const SyntheticTrace &spec, Trace *trace)
+{
+  TraceConfig config = traceDefaults(spec.seed, spec.text);
+  if (spec.clean)
+  {
+    config.adcNoise = config.gyroNoise = config.accelNoise = 0;
+    config.adcDrift = config.gyroDrift = 0;
+    config.dropoutsPerMin = 0;
+  }
+  if (spec.dropoutsPerMin > 0)
+  {
+    config.dropoutsPerMin = spec.dropoutsPerMin;
+  }
+  for (int i = 0; i < FLEX_COUNT; i++)
+  {
+    traceFlat[i] = measuredFlat[i % TRACE_SENSORS];
+    traceBend[i] = measuredBend[i % TRACE_SENSORS];
+  }
+  config.vcc = TRACE_VCC;
+  config.rDiv = TRACE_R_DIV;
+  config.flatResistance = traceFlat;
+  config.bendResistance = traceBend;
+  GestureTrace generator;
+  generator.begin(config);
+  trace->name = spec.name;
+  trace->samples.resize(spec.frames);
+  for (SensorSample &sample : trace->samples)
+  {
+    generator.next(&sample);
+  }
+}
+
+static bool load(const char *path, Trace *trace)
+{
+  RecordingFile file;
+  if (!file.open(path))
+  {
+    return false;
+  }
+  const char *slash = strrchr(path, '/');
+  trace->name = slash ? slash + 1 : path;
+  trace->name = trace->name.substr(0, trace->name.rfind('.'));
+  FrameCursor cursor(file);
+  RecordedFrame frame;
+  while (cursor.next(&frame))
+  {
+    trace->frames.push_back(frame);
+  }
+  return true;
+}
+
+static void convert(Trace *trace, const Calibration &calibration)
+{
+  trace->frames.resize(trace->samples.size());
+  for (size_t f = 0; f < trace->samples.size(); f++)
+  {
+    const SensorSample &sample = trace->samples[f];
+    RecordedFrame &frame = trace->frames[f];
+    calibration.flexAngles(sample.raw, frame.values);
+    traceImuToFrame(sample, frame.values);
+    frame.timeUs = sample.timeUs;
+  }
+}
+
+// Frames out of the wire messages, false if anything didn't survive the round trip
+static bool encode(const std::vector<RecordedFrame> &in, std::vector<RecordedFrame> *out)
+{
+  uint8_t buffer[PROTOCOL_OVERHEAD + GOLDEN_BATCH * FRAME_PAYLOAD_SIZE];
+  out->clear();
+  out->reserve(in.size());
+  uint16_t sequence = 0;
+  for (size_t start = 0; start < in.size(); start += GOLDEN_BATCH)
+  {
+    size_t count = in.size() - start < GOLDEN_BATCH ? in.size() - start : GOLDEN_BATCH;
+    uint8_t *payload = messagePayload(buffer);
+    for (size_t f = 0; f < count; f++)
+    {
+      const RecordedFrame &frame = in[start + f];
+      encodeFrame(frame.values, sequence++, (uint32_t)frame.timeUs, payload + f * FRAME_PAYLOAD_SIZE);
+    }
+    size_t length = sealMessage(buffer, sizeof(buffer), MSG_FRAME, count * FRAME_PAYLOAD_SIZE);
+    Message message;
+    if (parseMessage(buffer, length, &message) != PROTOCOL_OK || message.type != MSG_FRAME)
+    {
+      return false;
+    }
+    for (size_t f = 0; f < count; f++)
+    {
+      RecordedFrame frame;
+      uint16_t frameSequence;
+      uint32_t captureUs;
+      if (!decodeFrame(message.payload + f * FRAME_PAYLOAD_SIZE, FRAME_PAYLOAD_SIZE, frame.values, &frameSequence,
+                       &captureUs) ||
+          frameSequence != (uint16_t)(start + f))
+      {
+        return false;
+      }
+      frame.timeUs = in[start + f].timeUs - (uint32_t)in[start + f].timeUs + captureUs; // Wire time is 32 bits
+      out->push_back(frame);
+    }
+  }
+  return true;
+}
+
+static bool record(const std::vector<RecordedFrame> &in, std::vector<RecordedFrame> *out)
+{
+  std::vector<uint8_t> file;
+  uint8_t segment[RECORD_SEGMENT_SIZE];
+  SegmentWriter writer;
+  uint32_t sequence = 0;
+  writer.begin(segment, sequence);
+  for (const RecordedFrame &frame : in)
+  {
+    if (!writer.add(frame.values, (uint32_t)frame.timeUs))
+    {
+      writer.seal();
+      file.insert(file.end(), segment, segment + RECORD_SEGMENT_SIZE);
+      writer.begin(segment, ++sequence);
+      writer.add(frame.values, (uint32_t)frame.timeUs);
+    }
+  }
+  if (writer.frameCount() > 0)
+  {
+    writer.seal();
+    file.insert(file.end(), segment, segment + RECORD_SEGMENT_SIZE);
+  }
+  RecordingFile recording;
+  recording.attach(file.data(), file.size());
+  FrameCursor cursor(recording);
+  RecordedFrame frame;
+  out->clear();
+  out->reserve(in.size());
+  while (cursor.next(&frame))
+  {
+    out->push_back(frame);
+  }
+  return cursor.badSegments() == 0 && cursor.lostFrames() == 0;
+}
+
+static bool sameFrames(const std::vector<RecordedFrame> &a, const std::vector<RecordedFrame> &b)
+{
+  if (a.size() != b.size())
+  {
+    return false;
+  }
+  for (size_t f = 0; f < a.size(); f++)
+  {
+    if (a[f].timeUs != b[f].timeUs || memcmp(a[f].values, b[f].values, sizeof(a[f].values)) != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The whole pipeline, `trace->frames` holds the output afterwards
+static bool run(Trace *trace, Timings *timings)
+{
+  auto start = std::chrono::steady_clock::now();
+  if (!trace->samples.empty())
+  {
+    convert(trace, calibrations[0]);
+  }
+  timings->convert = secondsSince(start);
+
+  std::vector<RecordedFrame> encoded;
+  start = std::chrono::steady_clock::now();
+  bool ok = encode(trace->frames, &encoded);
+  timings->encode = secondsSince(start);
+  if (!ok || !sameFrames(trace->frames, encoded))
+  {
+    printf("%-12s encode round trip changed the frames\n", trace->name.c_str());
+    return false;
+  }
+
+  std::vector<RecordedFrame> recorded;
+  start = std::chrono::steady_clock::now();
+  ok = record(encoded, &recorded);
+  timings->record = secondsSince(start);
+  if (!ok || !sameFrames(encoded, recorded))
+  {
+    printf("%-12s record round trip changed the frames\n", trace->name.c_str());
+    return false;
+  }
+  trace->frames.swap(recorded);
+  return true;
+}
+
+static std::string goldenPath(const char *dir, const Trace &trace)
+{
+  return std::string(dir) + "/" + trace.name + ".csv";
+}
+
+static bool writeGolden(const char *path, const std::vector<RecordedFrame> &frames)
+{
+  FILE *out = fopen(path, "w");
+  if (!out)
+  {
+    return false;
+  }
+  fprintf(out, "time_us");
+  for (int c = 0; c < CHANNEL_COUNT; c++)
+  {
+    fprintf(out, ",%s", channelName(c));
+  }
+  fputc('\n', out);
+  for (const RecordedFrame &frame : frames)
+  {
+    fprintf(out, "%llu", (unsigned long long)frame.timeUs);
+    for (int c = 0; c < FRAME_VALUES; c++)
+    {
+      fprintf(out, ",%d", frame.values[c]);
+    }
+    fputc('\n', out);
+  }
+  return fclose(out) == 0;
+}
+
+static bool readGolden(const char *path, std::vector<RecordedFrame> *frames)
+{
+  FILE *in = fopen(path, "r");
+  if (!in)
+  {
+    return false;
+  }
+  char line[256];
+  bool ok = fgets(line, sizeof(line), in) != NULL; // Header
+  while (ok && fgets(line, sizeof(line), in))
+  {
+    RecordedFrame frame;
+    char *cursor = line;
+    frame.timeUs = strtoull(cursor, &cursor, 10);
+    for (int c = 0; c < FRAME_VALUES && ok; c++)
+    {
+      ok = *cursor == ',';
+      frame.values[c] = (int16_t)strtol(cursor + 1, &cursor, 10);
+    }
+    frames->push_back(frame);
+  }
+  fclose(in);
+  return ok;
+}
+
+static int tolerance(int channel)
+{
+  return channel < FLEX_COUNT ? GOLDEN_FLEX_TOLERANCE : GOLDEN_IMU_TOLERANCE;
+}
+
+// Prints the differences beyond tolerance, true if there are none
+static bool compare(const Trace &trace, const std::vector<RecordedFrame> &golden)
+{
+  if (golden.size() != trace.frames.size())
+  {
+    printf("%-12s FAIL %zu frames, golden has %zu\n", trace.name.c_str(), trace.frames.size(), golden.size());
+    return false;
+  }
+  unsigned long failed = 0;
+  size_t first = 0;
+  int worst[FRAME_VALUES] = {0};
+  for (size_t f = 0; f < golden.size(); f++)
+  {
+    bool bad = golden[f].timeUs != trace.frames[f].timeUs;
+    for (int c = 0; c < FRAME_VALUES; c++)
+    {
+      int diff = abs(golden[f].values[c] - trace.frames[f].values[c]);
+      worst[c] = diff > worst[c] ? diff : worst[c];
+      bad = bad || diff > tolerance(c);
+    }
+    first = (bad && failed == 0) ? f : first;
+    failed += bad;
+  }
+  if (failed == 0)
+  {
+    return true;
+  }
+  printf("%-12s FAIL %lu of %zu frames beyond tolerance, first at frame %zu\n", trace.name.c_str(), failed,
+         golden.size(), first);
+  for (int c = 0; c < FRAME_VALUES; c++)
+  {
+    if (worst[c] > tolerance(c))
+    {
+      printf("%-12s   %-8s off by up to %d\n", "", channelName(c), worst[c]);
+    }
+  }
+  return false;
+}
+
+static void printTimings(const Trace &trace, const Timings &timings, const char *result)
+{
+  double frames = (double)trace.frames.size();
+  char convertRate[16] = "      -"; // Recordings start at encode
+  if (!trace.samples.empty())
+  {
+    snprintf(convertRate, sizeof(convertRate), "%7.1f", frames / timings.convert / 1e6);
+  }
+  printf("%-12s %-4s %7zu frames  convert %s  encode %7.1f  record %7.1f M frames/s\n", trace.name.c_str(), result,
+         trace.frames.size(), convertRate, frames / timings.encode / 1e6, frames / timings.record / 1e6);
+}
+
+static bool loadTraces(int argc, char **argv, std::vector<Trace> *traces)
+{
+  for (const SyntheticTrace &spec : syntheticTraces)
+  {
+    traces->emplace_back();
+    generate(spec, &traces->back());
+  }
+  for (int i = 0; i < argc; i++)
+  {
+    traces->emplace_back();
+    if (!load(argv[i], &traces->back()))
+    {
+      fprintf(stderr, "golden: cannot map %s\n", argv[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+static int recordOrCheck(bool check, const char *dir, int argc, char **argv)
+{
+  std::vector<Trace> traces;
+  if (!loadTraces(argc, argv, &traces))
+  {
+    return 1;
+  }
+  bool passed = true;
+  for (Trace &trace : traces)
+  {
+    Timings timings;
+    if (!run(&trace, &timings))
+    {
+      passed = false;
+      continue;
+    }
+    std::string path = goldenPath(dir, trace);
+    if (!check)
+    {
+      if (!writeGolden(path.c_str(), trace.frames))
+      {
+        fprintf(stderr, "golden: cannot write %s\n", path.c_str());
+        return 1;
+      }
+      printTimings(trace, timings, "new");
+      continue;
+    }
+    std::vector<RecordedFrame> golden;
+    if (!readGolden(path.c_str(), &golden))
+    {
+      printf("%-12s FAIL no golden at %s\n", trace.name.c_str(), path.c_str());
+      passed = false;
+      continue;
+    }
+    bool same = compare(trace, golden);
+    printTimings(trace, timings, same ? "ok" : "FAIL");
+    passed = passed && same;
+  }
+  printf(passed ? "%s\n" : "%s, some traces differ\n", check ? "checked" : "recorded");
+  return passed ? 0 : 1;
+}
+
+// Every calibration on the same raw readings, against the bend the readings were generated from
+static int variants()
+{
+  printf("%-12s %-18s %s\n", "trace", "variant", "mean |error| per finger, degrees (frames off by more than 5)");
+  for (const SyntheticTrace &spec : syntheticTraces)
+  {
+    Trace trace;
+    generate(spec, &trace);
+    for (const Calibration &calibration : calibrations)
+    {
+      if (calibration.flexCount != FLEX_COUNT)
+      {
+        continue; // A prototype of another glove, its angles do not fill this frame
+      }
+      convert(&trace, calibration);
+      printf("%-12s %-18s", trace.name.c_str(), calibration.name);
+      for (int i = 0; i < FLEX_COUNT; i++)
+      {
+        double sum = 0;
+        unsigned long off = 0;
+        unsigned long counted = 0;
+        for (size_t f = 0; f < trace.samples.size(); f++)
+        {
+          if (trace.samples[f].raw[i] == 0)
+          {
+            continue; // Dropout, no angle to compare
+          }
+          double error = fabs(trace.frames[f].values[i] - trace.samples[f].angle[i]);
+          sum += error;
+          off += error > 5;
+          counted++;
+        }
+        printf("  %-6s %5.1f (%4.1f%%)", channelName(i), counted ? sum / counted : 0.0,
+               counted ? 100.0 * off / counted : 0.0);
+      }
+      putchar('\n');
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc >= 3 && strcmp(argv[1], "record") == 0)
+  {
+    return recordOrCheck(false, argv[2], argc - 3, argv + 3);
+  }
+  if (argc >= 3 && strcmp(argv[1], "check") == 0)
+  {
+    return recordOrCheck(true, argv[2], argc - 3, argv + 3);
+  }
+  if (argc == 2 && strcmp(argv[1], "variants") == 0)
+  {
+    return variants();
+  }
+  fprintf(stderr, "usage: golden record <dir> [file.rec ...]\n"
+                  "       golden check <dir> [file.rec ...]\n"
+                  "       golden variants\n");
+  return 1;
+}
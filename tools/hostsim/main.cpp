@@ -0,0 +1,82 @@
+// Host build of the acquisition pipeline.
+//
+//   hostsim [frames] [seed] [text]
+//
+// Runs the same conversion, frame building and logging code as the firmware
+// on simulated sensor readings and dumps the per-stage timing histograms.
+// The readings are a synthetic trace of someone spelling the text (see
+// GestureTrace.h), the same for the same seed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GlovePipeline.h"
+#include "GloveCalibration.h"
+#include "StageProfiler.h"
+#include "BinLog.h"
+#include "GestureTrace.h"
+
+#define DEFAULT_TEXT "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG "
+
+int main(int argc, char **argv)
+{
+  unsigned long frames = (argc > 1) ? strtoul(argv[1], NULL, 10) : 100000;
+  uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 10) : 1;
+  TraceConfig config = traceDefaults(seed, (argc > 3) ? argv[3] : DEFAULT_TEXT);
+  config.vcc = Glove::vcc;
+  config.rDiv = Glove::rDiv;
+  config.flatResistance = Glove::flatResistance;
+  config.bendResistance = Glove::bendResistance;
+  GestureTrace trace;
+  trace.begin(config);
+  SensorSample sample;
+  int16_t dataArray[FRAME_VALUES] = {0};
+  uint8_t notifyBuffer[sizeof(dataArray)];
+  uint8_t wire[BINLOG_WIRE_SIZE];
+  LogRecord record;
+  unsigned long checksum = 0;
+
+  for (unsigned long frame = 0; frame < frames; frame++)
+  {
+    PROFILE_STAGE(STAGE_FRAME);
+    trace.next(&sample); // Not timed, it stands in for the hardware
+    int raw[FLEX_COUNT];
+    float gyro[3];
+    float accel[3];
+    {
+      PROFILE_STAGE(STAGE_ADC);
+      memcpy(raw, sample.raw, sizeof(raw));
+    }
+    {
+      PROFILE_STAGE(STAGE_IMU);
+      memcpy(gyro, sample.gyro, sizeof(gyro));
+      memcpy(accel, sample.accel, sizeof(accel));
+    }
+    {
+      PROFILE_STAGE(STAGE_ANGLES);
+      Glove::flexAngles(raw, dataArray);
+      for (int i = 0; i < IMU_COUNT; i++)
+      {
+        imuToFrame(gyro, accel, dataArray, i); // Every IMU follows the wrist in the trace
+      }
+    }
+    {
+      PROFILE_STAGE(STAGE_NOTIFY);
+      memcpy(notifyBuffer, dataArray, sizeof(dataArray)); // What setValue() copies
+      checksum += notifyBuffer[frame % sizeof(notifyBuffer)];
+    }
+    {
+      PROFILE_STAGE(STAGE_LOG);
+      BINLOG(FLEX_ANGLES, dataArray[0], dataArray[1], dataArray[2], dataArray[3]);
+      BINLOG(NOTIFY, sizeof(dataArray));
+      while (logRing.pop(&record))
+      {
+        checksum += binlogEncode(record, wire); // Stand-in for the drain task
+      }
+    }
+  }
+
+  printf("%lu frames, %lu letters spelled (checksum %lu)\n", frames, trace.lettersSpelled(), checksum);
+  profiler.dump(stdout);
+  return 0;
+}
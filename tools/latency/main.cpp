@@ -0,0 +1,299 @@
+// Latency, jitter and loss report for a capture of data characteristic notifications.
+//
+//   latency capture.txt
+//
+// One notification per line: the host receive time in microseconds and the
+// GloveProtocol message in hex, e.g. "1699999123456 01011c002d00...". Lines
+// starting with '#' are ignored. Clock sync replies (see FrameFormat.h) in the same capture
+// map the glove's capture timestamps onto the host clock; with two or more
+// syncs the clock drift between them is fitted as well. Packed frames
+// (PackedFrame.h) get their sequence and capture time unwrapped against the
+// frame before them, the first one against the glove clock from the last sync.
+// Coded batches (FrameCodec.h) are decoded in order; blocks that can't be,
+// after one went missing and until the next key block, count as lost frames.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "PackedFrame.h"
+#include "FrameCodec.h"
+
+#define HISTOGRAM_BUCKET_US 1000 // 1 ms latency buckets
+#define HISTOGRAM_BUCKETS 100
+
+struct Sync
+{
+  double hostUs;   // Midpoint of the exchange on the host clock
+  double offsetUs; // Glove clock minus host clock
+  double rttUs;
+};
+
+struct Frame
+{
+  uint64_t hostRxUs;
+  uint16_t sequence;
+  uint32_t captureUs;
+};
+
+static size_t parseHex(const char *text, uint8_t *out, size_t capacity)
+{
+  size_t length = 0;
+  while (text[0] && text[1] && length < capacity)
+  {
+    if (text[0] == ' ' || text[0] == '\n' || text[0] == '\r')
+    {
+      text++;
+      continue;
+    }
+    unsigned value;
+    if (sscanf(text, "%2x", &value) != 1)
+    {
+      break;
+    }
+    out[length++] = (uint8_t)value;
+    text += 2;
+  }
+  return length;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    fprintf(stderr, "usage: latency capture.txt\n");
+    return 1;
+  }
+  FILE *input = fopen(argv[1], "r");
+  if (!input)
+  {
+    fprintf(stderr, "latency: cannot open %s\n", argv[1]);
+    return 1;
+  }
+
+  std::vector<Sync> syncs;
+  std::vector<Frame> frames;
+  unsigned long corrupt = 0; // Lines that are not a valid message
+  unsigned long undecodable = 0; // Coded blocks waiting for a key block, or broken
+  FrameDecoder decoder;
+  char line[2 * PROTOCOL_MAX_MESSAGE + 32];
+  while (fgets(line, sizeof(line), input))
+  {
+    if (line[0] == '#')
+    {
+      continue;
+    }
+    char *hex;
+    unsigned long long t4 = strtoull(line, &hex, 10);
+    uint8_t buffer[PROTOCOL_MAX_MESSAGE];
+    size_t length = parseHex(hex, buffer, sizeof(buffer));
+    Message message;
+    if (parseMessage(buffer, length, &message) != PROTOCOL_OK)
+    {
+      corrupt++;
+      continue;
+    }
+
+    if (message.type == MSG_SYNC && message.length == SYNC_REPLY_SIZE)
+    {
+      double t1 = (double)getLE(message.payload, 8);
+      double t2 = (double)getLE(message.payload + 8, 8);
+      double t3 = (double)getLE(message.payload + 16, 8);
+      Sync sync = {(t1 + t4) / 2, ((t2 - t1) + (t3 - t4)) / 2, (t4 - t1) - (t3 - t2)};
+      syncs.push_back(sync);
+    }
+    else if (message.type == MSG_FRAME)
+    {
+      // Batched frames all arrive with the notification that carries them
+      for (size_t at = 0; at + FRAME_PAYLOAD_SIZE <= message.length; at += FRAME_PAYLOAD_SIZE)
+      {
+        int16_t values[FRAME_VALUES];
+        Frame frame;
+        frame.hostRxUs = t4;
+        decodeFrame(message.payload + at, FRAME_PAYLOAD_SIZE, values, &frame.sequence, &frame.captureUs);
+        frames.push_back(frame);
+      }
+    }
+    else if (message.type == MSG_PACKED_FRAME && (!frames.empty() || !syncs.empty())) // Else nothing to unwrap against
+    {
+      for (size_t at = 0; at + PACKED_FRAME_SIZE <= message.length; at += PACKED_FRAME_SIZE)
+      {
+        int16_t values[FRAME_VALUES];
+        Frame frame;
+        frame.hostRxUs = t4;
+        if (!unpackFrame(message.payload + at, PACKED_FRAME_SIZE, values, &frame.sequence, &frame.captureUs))
+        {
+          break;
+        }
+        uint16_t lastSequence = frames.empty() ? frame.sequence : frames.back().sequence;
+        uint32_t lastCaptureUs = frames.empty() ? (uint32_t)(t4 + syncs.back().offsetUs) : frames.back().captureUs;
+        frame.sequence = (uint16_t)packedUnwrap(frame.sequence, lastSequence, packedSpan(0));
+        frame.captureUs = packedUnwrap(frame.captureUs, lastCaptureUs, packedSpan(1));
+        frames.push_back(frame);
+      }
+    }
+    else if (message.type == MSG_CODED_FRAMES)
+    {
+      CodecFrame block[CODEC_MAX_FRAMES];
+      int count;
+      if (decoder.decode(message.payload, message.length, block, CODEC_MAX_FRAMES, &count) != CODEC_OK)
+      {
+        undecodable++;
+        continue;
+      }
+      for (int i = 0; i < count; i++)
+      {
+        Frame frame = {t4, block[i].sequence, block[i].captureUs};
+        frames.push_back(frame);
+      }
+    }
+  }
+  fclose(input);
+
+  if (syncs.empty() || frames.empty())
+  {
+    fprintf(stderr, "latency: need at least one sync reply and one frame (%zu syncs, %zu frames)\n", syncs.size(),
+            frames.size());
+    return 1;
+  }
+
+  // offset(t) = a + b * t, least squares over all syncs (constant with only one)
+  double a = syncs[0].offsetUs;
+  double b = 0;
+  if (syncs.size() > 1)
+  {
+    double n = syncs.size(), sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (const Sync &s : syncs)
+    {
+      double x = s.hostUs - syncs[0].hostUs;
+      sx += x;
+      sy += s.offsetUs;
+      sxx += x * x;
+      sxy += x * s.offsetUs;
+    }
+    double denominator = n * sxx - sx * sx;
+    if (denominator != 0)
+    {
+      b = (n * sxy - sx * sy) / denominator;
+      a = (sy - b * sx) / n;
+    }
+  }
+  double bestRtt = syncs[0].rttUs;
+  for (const Sync &s : syncs)
+  {
+    bestRtt = std::min(bestRtt, s.rttUs);
+  }
+
+  std::vector<double> latencies;
+  std::vector<double> intervals;
+  unsigned long lost = 0;
+  unsigned long duplicates = 0;
+  unsigned histogram[HISTOGRAM_BUCKETS + 1] = {0};
+
+  // The glove numbers every frame it publishes, a central subscribed at a lower rate than
+  // another one sees a regular stride instead of consecutive numbers
+  uint16_t stride = 0xFFFF;
+  for (size_t i = 1; i < frames.size(); i++)
+  {
+    uint16_t gap = (uint16_t)(frames[i].sequence - frames[i - 1].sequence);
+    if (gap > 0 && gap < 0x8000)
+    {
+      stride = std::min(stride, gap);
+    }
+  }
+
+  for (size_t i = 0; i < frames.size(); i++)
+  {
+    const Frame &f = frames[i];
+    double offset = a + b * ((double)f.hostRxUs - syncs[0].hostUs);
+
+    // The capture time is the low 32 bits of the glove clock, unwrap it near the expected value
+    double expected = (double)f.hostRxUs + offset;
+    double wraps = floor((expected - f.captureUs) / 4294967296.0 + 0.5);
+    double captureHost = f.captureUs + wraps * 4294967296.0 - offset;
+    double latency = (double)f.hostRxUs - captureHost;
+    latencies.push_back(latency);
+
+    int bucket = (int)(latency / HISTOGRAM_BUCKET_US);
+    histogram[std::max(0, std::min(bucket, HISTOGRAM_BUCKETS))]++;
+
+    if (i > 0)
+    {
+      uint16_t gap = (uint16_t)(f.sequence - frames[i - 1].sequence);
+      if (gap == 0)
+      {
+        duplicates++;
+      }
+      else if (gap < 0x8000)
+      {
+        lost += (gap + stride / 2) / stride - 1;
+      }
+      intervals.push_back((double)f.hostRxUs - (double)frames[i - 1].hostRxUs);
+    }
+  }
+
+  std::vector<double> sorted = latencies;
+  std::sort(sorted.begin(), sorted.end());
+  double mean = 0, variance = 0;
+  for (double l : latencies)
+  {
+    mean += l;
+  }
+  mean /= latencies.size();
+  for (double l : latencies)
+  {
+    variance += (l - mean) * (l - mean);
+  }
+  double intervalMean = 0, intervalVariance = 0;
+  for (double d : intervals)
+  {
+    intervalMean += d;
+  }
+  if (!intervals.empty())
+  {
+    intervalMean /= intervals.size();
+    for (double d : intervals)
+    {
+      intervalVariance += (d - intervalMean) * (d - intervalMean);
+    }
+    intervalVariance /= intervals.size();
+  }
+
+  unsigned long expectedFrames = frames.size() + lost;
+  printf("syncs            %zu (best round trip %.0f us, drift %.1f ppm)\n", syncs.size(), bestRtt, b * 1e6);
+  printf("frames           %zu received, %lu lost, %lu duplicate, loss %.2f%%\n", frames.size(), lost, duplicates,
+         100.0 * lost / expectedFrames);
+  if (corrupt > 0)
+  {
+    printf("corrupt lines    %lu\n", corrupt);
+  }
+  if (undecodable > 0)
+  {
+    printf("undecoded blocks %lu\n", undecodable);
+  }
+  printf("latency ms       min %.2f  mean %.2f  p50 %.2f  p99 %.2f  max %.2f  jitter(sd) %.2f\n", sorted.front() / 1000,
+         mean / 1000, sorted[sorted.size() / 2] / 1000, sorted[sorted.size() - 1 - sorted.size() / 100] / 1000,
+         sorted.back() / 1000, sqrt(variance / latencies.size()) / 1000);
+  printf("interval ms      mean %.2f  jitter(sd) %.2f\n", intervalMean / 1000, sqrt(intervalVariance) / 1000);
+  printf("latency histogram (1 ms buckets)\n");
+  for (int i = 0; i <= HISTOGRAM_BUCKETS; i++)
+  {
+    if (histogram[i] == 0)
+    {
+      continue;
+    }
+    if (i == HISTOGRAM_BUCKETS)
+    {
+      printf("  >=%3d ms %8u\n", HISTOGRAM_BUCKETS, histogram[i]);
+    }
+    else
+    {
+      printf("  %3d-%-3d ms %6u\n", i, i + 1, histogram[i]);
+    }
+  }
+  return 0;
+}
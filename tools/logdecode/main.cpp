@@ -0,0 +1,138 @@
+// Host decoder for the binary log stream written by BinLog.
+//
+//   logdecode [capture.bin]      (reads stdin without an argument)
+//
+// Records are found by their sync byte and checksum, so text printed by
+// the bootloader or a half-received record at the start are skipped.
+
+#include <stdio.h>
+#include <string.h>
+#include "BinLog.h"
+
+struct MessageInfo
+{
+  const char *name;
+  uint8_t level;
+  const char *format;
+};
+
+static const MessageInfo messages[LOG_ID_COUNT] = {
+#define BINLOG_INFO(name, level, format) {#name, level, format},
+    GLOVE_LOG_MESSAGES(BINLOG_INFO)
+#undef BINLOG_INFO
+};
+
+static const char *levelNames[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+// printf the format string one conversion at a time, so float arguments
+// can be turned back from their bit patterns
+static void formatRecord(const LogRecord &record, char *out, size_t size)
+{
+  const char *format = messages[record.id].format;
+  size_t used = 0;
+  int arg = 0;
+  out[0] = '\0';
+
+  while (*format && used < size - 1)
+  {
+    if (*format != '%' || format[1] == '%')
+    {
+      out[used++] = *format;
+      format += (*format == '%') ? 2 : 1;
+      out[used] = '\0';
+      continue;
+    }
+
+    // Copy one conversion spec, e.g. "%.2f"
+    char spec[16];
+    size_t length = 0;
+    do
+    {
+      spec[length++] = *format++;
+    } while (*format && !strchr("diuxXfgec", format[-1]) && length < sizeof(spec) - 1);
+    spec[length] = '\0';
+
+    int32_t value = (arg < record.argc) ? record.args[arg] : 0;
+    arg++;
+    char conversion = spec[length - 1];
+    if (conversion == 'f' || conversion == 'g' || conversion == 'e')
+    {
+      float f;
+      memcpy(&f, &value, sizeof(f));
+      used += snprintf(out + used, size - used, spec, (double)f);
+    }
+    else if (conversion == 'd' || conversion == 'i' || conversion == 'c')
+    {
+      used += snprintf(out + used, size - used, spec, (int)value);
+    }
+    else
+    {
+      used += snprintf(out + used, size - used, spec, (unsigned)value);
+    }
+    if (used >= size)
+    {
+      used = size - 1;
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  FILE *input = (argc > 1) ? fopen(argv[1], "rb") : stdin;
+  if (!input)
+  {
+    fprintf(stderr, "logdecode: cannot open %s\n", argv[1]);
+    return 1;
+  }
+
+  uint8_t wire[BINLOG_WIRE_SIZE];
+  size_t filled = 0;
+  unsigned long records = 0;
+  unsigned long skipped = 0;
+  int c;
+
+  while ((c = fgetc(input)) != EOF)
+  {
+    if (filled == 0 && c != BINLOG_SYNC)
+    {
+      skipped++;
+      continue;
+    }
+    wire[filled++] = (uint8_t)c;
+    if (filled < BINLOG_WIRE_SIZE)
+    {
+      continue;
+    }
+
+    LogRecord record;
+    memcpy(&record, wire + 1, sizeof(record));
+    uint8_t checksum = 0;
+    for (size_t i = 0; i < sizeof(record); i++)
+    {
+      checksum ^= wire[1 + i];
+    }
+
+    if (checksum != wire[BINLOG_WIRE_SIZE - 1] || record.id >= LOG_ID_COUNT || record.argc > BINLOG_MAX_ARGS)
+    {
+      // Not a record after all, resync on the next sync byte inside the window
+      size_t next = 1;
+      while (next < filled && wire[next] != BINLOG_SYNC)
+      {
+        next++;
+      }
+      skipped += next;
+      memmove(wire, wire + next, filled - next);
+      filled -= next;
+      continue;
+    }
+
+    char text[256];
+    formatRecord(record, text, sizeof(text));
+    printf("%10.6f %-5s %s\n", record.timestampUs / 1e6, levelNames[record.level < 4 ? record.level : 3], text);
+    records++;
+    filled = 0;
+  }
+
+  fprintf(stderr, "logdecode: %lu records, %lu bytes skipped\n", records, skipped);
+  return 0;
+}
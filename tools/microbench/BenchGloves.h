@@ -0,0 +1,60 @@
+#ifndef BENCH_GLOVES_H
+#define BENCH_GLOVES_H
+
+#include <array>
+#include "GloveProfiles.h"
+
+// Made-up glove variants for the acquisition benchmarks, Channels flex
+// sensors split evenly over Muxes multiplexers (the first ones get the
+// remainder), with the 3.3 V prototype's sensors on every channel.
+// Shared by microbench and scansim.
+
+template <int Channels, int Muxes, int SettleUs = 8>
+struct BenchGlove
+{
+  static constexpr const char *name = "bench";
+  static constexpr int flexCount = Channels;
+  static constexpr int muxCount = Muxes;
+
+  static constexpr std::array<uint8_t, Channels> wire()
+  {
+    std::array<uint8_t, Channels> inputs{};
+    int channel = 0;
+    for (int mux = 0; mux < Muxes; mux++)
+    {
+      int count = Channels / Muxes + (mux < Channels % Muxes);
+      for (int input = 0; input < count; input++)
+      {
+        inputs[channel++] = (uint8_t)(mux * MUX_INPUTS + input);
+      }
+    }
+    return inputs;
+  }
+
+  template <typename T>
+  static constexpr std::array<T, Channels> fill(T value)
+  {
+    std::array<T, Channels> values{};
+    for (T &v : values)
+    {
+      v = value;
+    }
+    return values;
+  }
+
+  static constexpr std::array<uint8_t, Muxes> muxAdcPins{};
+  static constexpr uint8_t muxSelectPins[Muxes][MUX_SELECT_BITS] = {};
+  static constexpr std::array<uint8_t, Channels> flexMuxInputs = wire();
+  static constexpr int muxSettleUs = SettleUs;
+  static constexpr double vcc = GlovePrototype3V3::vcc;
+  static constexpr double rDiv = GlovePrototype3V3::rDiv;
+  static constexpr std::array<float, Channels> flatResistance = fill(GlovePrototype3V3::flatResistance[0]);
+  static constexpr std::array<float, Channels> bendResistance = fill(GlovePrototype3V3::bendResistance[0]);
+  static constexpr int imuCount = 1;
+  static constexpr uint8_t imuAddresses[imuCount] = {0x68};
+  static constexpr int imuAccelRangeG = 8;
+  static constexpr int imuGyroRangeDps = 500;
+  static constexpr int imuFilterHz = 21;
+};
+
+#endif
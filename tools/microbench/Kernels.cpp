@@ -0,0 +1,332 @@
+// The firmware's per-frame hot paths as micro-benchmarks, fed with a synthetic
+// trace (GestureTrace.h) so the data looks like a hand and not like zeros.
+
+#include <string.h>
+#include "MicroBench.h"
+#include "GlovePipeline.h"
+#include "GloveCalibration.h"
+#include "GloveProtocol.h"
+#include "FrameFormat.h"
+#include "PackedFrame.h"
+#include "FrameCodec.h"
+#include "RecordFormat.h"
+#include "GestureTrace.h"
+#include "BinLog.h"
+#include "StageProfiler.h"
+#include "TextLayout.h"
+
+#define INPUT_FRAMES 256 // Power of two, cycled through by the benchmarks
+#define BATCH 8          // Frames per notification at the pacer's largest batch
+#define BLOCKS (INPUT_FRAMES / BATCH) // Coded blocks of the input, the first one a key block
+#define SCREEN_WIDTH 240 // T-Display in landscape
+#define SCREEN_HEIGHT 135
+
+static_assert(BLOCKS % CODEC_KEY_INTERVAL == 0, "the coded input is whole key intervals, decoding can cycle through it");
+
+struct Inputs
+{
+  SensorSample samples[INPUT_FRAMES];
+  int16_t frames[INPUT_FRAMES][FRAME_VALUES];
+  uint8_t payloads[INPUT_FRAMES][FRAME_PAYLOAD_SIZE];
+  uint8_t packed[INPUT_FRAMES][PACKED_FRAME_SIZE];
+  CodecFrame codec[INPUT_FRAMES];
+  uint8_t blocks[BLOCKS][CODEC_MAX_BLOCK(BATCH)];
+  size_t blockLengths[BLOCKS];
+  uint8_t message[PROTOCOL_OVERHEAD + BATCH * FRAME_PAYLOAD_SIZE];
+  size_t messageLength;
+  uint8_t segment[RECORD_SEGMENT_SIZE];
+};
+
+static Inputs *inputs()
+{
+  static Inputs *data = NULL;
+  if (data)
+  {
+    return data;
+  }
+  data = new Inputs;
+  TraceConfig config = traceDefaults(1, "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG ");
+  config.vcc = Glove::vcc;
+  config.rDiv = Glove::rDiv;
+  config.flatResistance = Glove::flatResistance;
+  config.bendResistance = Glove::bendResistance;
+  GestureTrace trace;
+  trace.begin(config);
+  for (int f = 0; f < INPUT_FRAMES; f++)
+  {
+    // Every 8th sample, a few letters' worth of hand shapes in the set
+    for (int skip = 0; skip < 8; skip++)
+    {
+      trace.next(&data->samples[f]);
+    }
+    const SensorSample &sample = data->samples[f];
+    Glove::flexAngles(sample.raw, data->frames[f]);
+    traceImuToFrame(sample, data->frames[f]);
+    encodeFrame(data->frames[f], (uint16_t)f, sample.timeUs, data->payloads[f]);
+    packFrame(data->frames[f], (uint16_t)f, sample.timeUs, data->packed[f]);
+    memcpy(data->codec[f].values, data->frames[f], sizeof(data->codec[f].values));
+    data->codec[f].sequence = (uint16_t)f;
+    data->codec[f].captureUs = sample.timeUs;
+  }
+  FrameEncoder encoder;
+  for (int b = 0; b < BLOCKS; b++)
+  {
+    data->blockLengths[b] = encoder.encode(data->codec + b * BATCH, BATCH, data->blocks[b], sizeof(data->blocks[b]));
+  }
+  for (int f = 0; f < BATCH; f++)
+  {
+    memcpy(messagePayload(data->message) + f * FRAME_PAYLOAD_SIZE, data->payloads[f], FRAME_PAYLOAD_SIZE);
+  }
+  data->messageLength = sealMessage(data->message, sizeof(data->message), MSG_FRAME, BATCH * FRAME_PAYLOAD_SIZE);
+
+  SegmentWriter writer;
+  writer.begin(data->segment, 0);
+  for (int f = 0; writer.add(data->frames[f % INPUT_FRAMES], data->samples[f % INPUT_FRAMES].timeUs); f++)
+  {
+  }
+  writer.seal();
+  return data;
+}
+
+// processSensorData: five ADC readings to bend angles, with the divider math at runtime
+MICROBENCH(flex_angles)
+{
+  const Inputs *in = inputs();
+  int16_t frame[FRAME_VALUES];
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    const SensorSample &sample = in->samples[f++ % INPUT_FRAMES];
+    for (int i = 0; i < FLEX_COUNT; i++)
+    {
+      volatile double vcc = Glove::vcc; // Keeps the constants from folding, as a runtime calibration would
+      frame[i] = flexAngle(sample.raw[i], vcc, Glove::rDiv, Glove::flatResistance[i], Glove::bendResistance[i]);
+    }
+    benchKeep(frame);
+  }
+}
+
+// The same from the profile's compile time table, what the firmware does
+MICROBENCH(flex_angles_table)
+{
+  const Inputs *in = inputs();
+  int16_t frame[FRAME_VALUES];
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    Glove::flexAngles(in->samples[f++ % INPUT_FRAMES].raw, frame);
+    benchKeep(frame);
+  }
+}
+
+MICROBENCH(imu_to_frame)
+{
+  const Inputs *in = inputs();
+  int16_t frame[FRAME_VALUES];
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    const SensorSample &sample = in->samples[f++ % INPUT_FRAMES];
+    imuToFrame(sample.gyro, sample.accel, frame);
+    benchKeep(frame);
+  }
+}
+
+MICROBENCH(frame_encode)
+{
+  const Inputs *in = inputs();
+  uint8_t payload[FRAME_PAYLOAD_SIZE];
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    unsigned index = f++ % INPUT_FRAMES;
+    encodeFrame(in->frames[index], (uint16_t)f, in->samples[index].timeUs, payload);
+    benchKeep(payload);
+  }
+}
+
+MICROBENCH(frame_decode)
+{
+  const Inputs *in = inputs();
+  int16_t values[FRAME_VALUES];
+  uint16_t sequence;
+  uint32_t captureUs;
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    decodeFrame(in->payloads[f++ % INPUT_FRAMES], FRAME_PAYLOAD_SIZE, values, &sequence, &captureUs);
+    benchKeep(values);
+  }
+}
+
+MICROBENCH(packed_encode)
+{
+  const Inputs *in = inputs();
+  uint8_t payload[PACKED_FRAME_SIZE];
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    unsigned index = f++ % INPUT_FRAMES;
+    packFrame(in->frames[index], (uint16_t)f, in->samples[index].timeUs, payload);
+    benchKeep(payload);
+  }
+}
+
+MICROBENCH(packed_decode)
+{
+  const Inputs *in = inputs();
+  int16_t values[FRAME_VALUES];
+  uint16_t sequence;
+  uint32_t captureUs;
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    unpackFrame(in->packed[f++ % INPUT_FRAMES], PACKED_FRAME_SIZE, values, &sequence, &captureUs);
+    benchKeep(values);
+  }
+}
+
+// A coded session's full batch, per frame
+MICROBENCH(codec_encode)
+{
+  const Inputs *in = inputs();
+  FrameEncoder encoder;
+  uint8_t block[CODEC_MAX_BLOCK(BATCH)];
+  unsigned b = 0;
+  state.setItemsPerIteration(BATCH);
+  while (state.keepRunning())
+  {
+    encoder.encode(in->codec + (b++ % BLOCKS) * BATCH, BATCH, block, sizeof(block));
+    benchKeep(block);
+  }
+}
+
+MICROBENCH(codec_decode)
+{
+  const Inputs *in = inputs();
+  FrameDecoder decoder;
+  CodecFrame frames[BATCH];
+  int count;
+  unsigned b = 0;
+  state.setItemsPerIteration(BATCH);
+  while (state.keepRunning())
+  {
+    unsigned index = b++ % BLOCKS;
+    decoder.decode(in->blocks[index], in->blockLengths[index], frames, BATCH, &count);
+    benchKeep(frames);
+  }
+}
+
+// Header and CRC around a full batch, per frame
+MICROBENCH(message_seal)
+{
+  uint8_t message[sizeof(Inputs::message)];
+  memcpy(message, inputs()->message, sizeof(message));
+  state.setItemsPerIteration(BATCH);
+  while (state.keepRunning())
+  {
+    benchKeep(sealMessage(message, sizeof(message), MSG_FRAME, BATCH * FRAME_PAYLOAD_SIZE));
+  }
+}
+
+MICROBENCH(message_parse)
+{
+  const Inputs *in = inputs();
+  Message message;
+  state.setItemsPerIteration(BATCH);
+  while (state.keepRunning())
+  {
+    benchKeep(parseMessage(in->message, in->messageLength, &message));
+  }
+}
+
+MICROBENCH(record_add)
+{
+  const Inputs *in = inputs();
+  static uint8_t segment[RECORD_SEGMENT_SIZE];
+  SegmentWriter writer;
+  writer.begin(segment, 0);
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    unsigned index = f++ % INPUT_FRAMES;
+    if (!writer.add(in->frames[index], in->samples[index].timeUs))
+    {
+      writer.begin(segment, 0); // A full segment goes to the writer task on the glove
+    }
+  }
+  benchKeep(segment);
+}
+
+MICROBENCH(record_read)
+{
+  const Inputs *in = inputs();
+  SegmentReader reader;
+  reader.begin(in->segment);
+  int16_t values[FRAME_VALUES];
+  uint32_t captureUs;
+  while (state.keepRunning())
+  {
+    if (!reader.next(values, &captureUs))
+    {
+      reader.begin(in->segment);
+    }
+    benchKeep(values);
+  }
+}
+
+// The records the loop logs every frame, encoded as the drain task would
+MICROBENCH(binlog_frame)
+{
+  const Inputs *in = inputs();
+  LogRecord record;
+  uint8_t wire[BINLOG_WIRE_SIZE];
+  unsigned f = 0;
+  while (state.keepRunning())
+  {
+    const int16_t *frame = in->frames[f++ % INPUT_FRAMES];
+    int flex = 0;
+    for (; flex + 4 <= FLEX_COUNT; flex += 4)
+    {
+      BINLOG(FLEX_ANGLES, frame[flex], frame[flex + 1], frame[flex + 2], frame[flex + 3]);
+    }
+    for (; flex < FLEX_COUNT; flex++)
+    {
+      BINLOG(FLEX_ANGLE, flex, frame[flex]);
+    }
+    for (int i = 0; i < IMU_COUNT; i++)
+    {
+      const int16_t *imu = frame + FRAME_IMU(i);
+      BINLOG(IMU_GYRO, i, imu[0] / (float)IMU_SCALE, imu[1] / (float)IMU_SCALE, imu[2] / (float)IMU_SCALE);
+      BINLOG(IMU_ACCEL, i, imu[3] / (float)IMU_SCALE, imu[4] / (float)IMU_SCALE, imu[5] / (float)IMU_SCALE);
+    }
+    while (logRing.pop(&record))
+    {
+      benchKeep(binlogEncode(record, wire));
+    }
+  }
+}
+
+MICROBENCH(profile_stage)
+{
+  while (state.keepRunning())
+  {
+    PROFILE_STAGE(STAGE_LOG);
+  }
+}
+
+// drawWrappedText without the drawing, per glyph
+MICROBENCH(text_layout)
+{
+  static const char text[] = "Waiting for connection... \xE2\x80\x9CHello\xE2\x80\x9D \xE2\x80\x94 caf\xC3\xA9 na\xC3\xAFve 100\xE2\x82\xAC";
+  int glyphs = 0;
+  layoutWrapped(text, 10, 20, SCREEN_WIDTH, SCREEN_HEIGHT, 7, 13, [&](uint32_t, int, int, bool) { glyphs++; });
+  state.setItemsPerIteration(glyphs);
+  while (state.keepRunning())
+  {
+    uint32_t sum = 0;
+    layoutWrapped(text, 10, 20, SCREEN_WIDTH, SCREEN_HEIGHT, 7, 13,
+                  [&](uint32_t codepoint, int x, int y, bool clear) { sum += codepoint + x + y + clear; });
+    benchKeep(sum);
+  }
+}
@@ -0,0 +1,82 @@
+// Flex acquisition at 5, 10 and 16 channels: the scan schedule (FlexScan.h)
+// and the angle tables, per channel. The ADC and multiplexers are replaced
+// by readings from a synthetic trace, so this is the CPU's share only, see
+// tools/scansim for where the time on the glove goes.
+
+#include "MicroBench.h"
+#include "FlexScan.h"
+#include "GestureTrace.h"
+#include "GloveCalibration.h"
+#include "BenchGloves.h"
+
+#define TRACE_READINGS 1024 // Power of two, cycled through by the benchmarks
+
+// Hands out trace readings in place of conversions, settling is instant
+struct TraceIo
+{
+  int readings[TRACE_READINGS];
+  unsigned next = 0;
+  unsigned selects = 0;
+
+  TraceIo()
+  {
+    TraceConfig config = traceDefaults(2, "ABDUCTION ");
+    config.vcc = Glove::vcc;
+    config.rDiv = Glove::rDiv;
+    config.flatResistance = Glove::flatResistance;
+    config.bendResistance = Glove::bendResistance;
+    GestureTrace trace;
+    trace.begin(config);
+    for (int i = 0; i < TRACE_READINGS; i += FLEX_COUNT)
+    {
+      SensorSample sample;
+      trace.next(&sample);
+      for (int c = 0; c < FLEX_COUNT && i + c < TRACE_READINGS; c++)
+      {
+        readings[i + c] = sample.raw[c];
+      }
+    }
+  }
+
+  void select(int mux, int input) { selects += mux + input; }
+  int convert(int) { return readings[next++ % TRACE_READINGS]; }
+  uint32_t nowUs() { return 0; }
+  void waitUntilUs(uint32_t) {}
+};
+
+// One scan and its angles, what processSensorData does per frame
+template <typename Profile>
+static void acquire(BenchState &state)
+{
+  static TraceIo io;
+  FlexScanner<Profile, TraceIo> scanner(io);
+  scanner.begin();
+  int raw[Profile::flexCount];
+  int16_t frame[Profile::frameValues];
+  state.setItemsPerIteration(Profile::flexCount);
+  while (state.keepRunning())
+  {
+    scanner.scan(raw);
+    Profile::flexAngles(raw, frame);
+    benchKeep(frame);
+  }
+  benchKeep(io.selects);
+}
+
+// The T-Display glove, every sensor on its own pin
+MICROBENCH(flex_acquire_5)
+{
+  acquire<GloveProfile<GloveTDisplay5V>>(state);
+}
+
+// The abduction glove, two multiplexers
+MICROBENCH(flex_acquire_10)
+{
+  acquire<GloveProfile<GloveAbduction>>(state);
+}
+
+// Every input of one multiplexer's worth, over two
+MICROBENCH(flex_acquire_16)
+{
+  acquire<GloveProfile<BenchGlove<16, 2>>>(state);
+}
@@ -0,0 +1,46 @@
+// Runner for the micro-benchmarks in Kernels.cpp and ScanKernels.cpp, on the host or on the glove.
+//
+//   microbench [filter]      host: runs the benchmarks whose name contains filter
+//
+// The microbench-device environment builds the same file as firmware. It runs
+// every benchmark once after boot and prints the same CSV on the serial port,
+// with the CPU cycles per item filled in.
+
+#include <stdio.h>
+#include "MicroBench.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+static void printSerial(const char *line)
+{
+  Serial.println(line);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(2000); // Time for the monitor to attach after the upload resets the board
+  runBenchmarks(NULL, printSerial);
+  Serial.println("# done");
+}
+
+void loop()
+{
+  delay(1000);
+}
+
+#else
+
+static void printStdout(const char *line)
+{
+  puts(line);
+}
+
+int main(int argc, char **argv)
+{
+  runBenchmarks(argc > 1 ? argv[1] : NULL, printStdout);
+  return 0;
+}
+
+#endif
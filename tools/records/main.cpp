@@ -0,0 +1,217 @@
+// Offline tools for recordings pulled off the glove (see RecordFormat.h and RecordReader.h).
+//
+//   records info <file.rec>             segments, frames, duration and per channel ranges
+//   records convert <file.rec> <out.col> columnar file, one array per channel
+//   records bench [file.rec | FRAMES]   frames decoded per second, synthetic data if no file
+//
+// The benchmark times the zero-copy cursor, the columnar conversion and a
+// batch evaluation (mean and variance of every channel) over the columns.
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "RecordFormat.h"
+#include "RecordReader.h"
+
+#define BENCH_FRAME_US 10000 // 100 Hz, the glove's fastest frame rate
+#define BENCH_MIN_SECONDS 0.5
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Slow sweeps on the fingers and noisy motion on the IMU, roughly what a signing hand looks like
+static std::vector<uint8_t> synthesize(unsigned long frames)
+{
+  std::vector<uint8_t> file;
+  uint8_t segment[RECORD_SEGMENT_SIZE];
+  SegmentWriter writer;
+  uint32_t sequence = 0;
+  writer.begin(segment, sequence);
+  for (unsigned long f = 0; f < frames; f++)
+  {
+    int16_t values[FRAME_VALUES];
+    for (int c = 0; c < FLEX_COUNT; c++)
+    {
+      values[c] = (int16_t)(45 + 45 * sin(f * 0.02 * (c + 1)));
+    }
+    for (int c = FLEX_COUNT; c < FRAME_VALUES; c++)
+    {
+      values[c] = (int16_t)(200 * sin(f * 0.05 + c) + rand() % 21 - 10);
+    }
+    uint32_t captureUs = (uint32_t)(f * BENCH_FRAME_US + rand() % 200);
+    if (!writer.add(values, captureUs))
+    {
+      writer.seal();
+      file.insert(file.end(), segment, segment + RECORD_SEGMENT_SIZE);
+      writer.begin(segment, ++sequence);
+      writer.add(values, captureUs);
+    }
+  }
+  if (writer.frameCount() > 0)
+  {
+    writer.seal();
+    file.insert(file.end(), segment, segment + RECORD_SEGMENT_SIZE);
+  }
+  return file;
+}
+
+static int info(const char *path)
+{
+  RecordingFile file;
+  if (!file.open(path))
+  {
+    fprintf(stderr, "records: cannot map %s\n", path);
+    return 1;
+  }
+  FrameCursor cursor(file);
+  RecordedFrame frame;
+  unsigned long frames = 0;
+  uint64_t firstUs = 0;
+  uint64_t lastUs = 0;
+  int16_t low[FRAME_VALUES];
+  int16_t high[FRAME_VALUES];
+  while (cursor.next(&frame))
+  {
+    for (int c = 0; c < FRAME_VALUES; c++)
+    {
+      low[c] = frames == 0 || frame.values[c] < low[c] ? frame.values[c] : low[c];
+      high[c] = frames == 0 || frame.values[c] > high[c] ? frame.values[c] : high[c];
+    }
+    firstUs = frames == 0 ? frame.timeUs : firstUs;
+    lastUs = frame.timeUs;
+    frames++;
+  }
+  printf("segments   %zu, %u bad, %u frames lost in them\n", file.segmentCount(), cursor.badSegments(),
+         cursor.lostFrames());
+  printf("frames     %lu over %.1f s, %.1f B per frame on flash\n", frames, (lastUs - firstUs) / 1e6,
+         frames ? (double)file.size() / frames : 0.0);
+  for (int c = 0; c < FRAME_VALUES && frames > 0; c++)
+  {
+    printf("%-10s %6d .. %d\n", channelName(c), low[c], high[c]);
+  }
+  return 0;
+}
+
+static int convert(const char *path, const char *outPath)
+{
+  RecordingFile file;
+  if (!file.open(path))
+  {
+    fprintf(stderr, "records: cannot map %s\n", path);
+    return 1;
+  }
+  FrameColumns columns;
+  size_t frames = readColumns(file, &columns);
+  if (!writeColumns(outPath, columns))
+  {
+    fprintf(stderr, "records: cannot write %s\n", outPath);
+    return 1;
+  }
+  printf("%zu frames, %d channels written to %s\n", frames, CHANNEL_COUNT, outPath);
+  return 0;
+}
+
+static int bench(int argc, char **argv)
+{
+  std::vector<uint8_t> synthetic;
+  RecordingFile file;
+  if (argc > 2 && !isdigit((unsigned char)argv[2][0]))
+  {
+    if (!file.open(argv[2]))
+    {
+      fprintf(stderr, "records: cannot map %s\n", argv[2]);
+      return 1;
+    }
+  }
+  else
+  {
+    synthetic = synthesize(argc > 2 ? strtoul(argv[2], NULL, 10) : 1000000);
+    file.attach(synthetic.data(), synthetic.size());
+  }
+  printf("%zu segments, %.1f MB\n", file.segmentCount(), file.size() / 1e6);
+
+  // Cursor: decode every frame in place, summed so nothing is optimized away
+  unsigned long frames = 0;
+  int64_t checksum = 0;
+  int passes = 0;
+  auto start = std::chrono::steady_clock::now();
+  do
+  {
+    FrameCursor cursor(file);
+    RecordedFrame frame;
+    while (cursor.next(&frame))
+    {
+      checksum += frame.values[0] + frame.values[FRAME_VALUES - 1];
+      frames++;
+    }
+    passes++;
+  } while (secondsSince(start) < BENCH_MIN_SECONDS);
+  double cursorSeconds = secondsSince(start);
+
+  // Columnar conversion
+  FrameColumns columns;
+  unsigned long converted = 0;
+  start = std::chrono::steady_clock::now();
+  do
+  {
+    converted += readColumns(file, &columns);
+  } while (secondsSince(start) < BENCH_MIN_SECONDS);
+  double convertSeconds = secondsSince(start);
+
+  // Batch evaluation over whole columns
+  unsigned long evaluated = 0;
+  double mean[CHANNEL_COUNT];
+  double deviation[CHANNEL_COUNT];
+  start = std::chrono::steady_clock::now();
+  do
+  {
+    for (int c = 0; c < CHANNEL_COUNT; c++)
+    {
+      const int16_t *column = columns.channels[c].data();
+      int64_t sum = 0;
+      int64_t squares = 0;
+      for (size_t i = 0; i < columns.size(); i++)
+      {
+        sum += column[i];
+        squares += (int32_t)column[i] * column[i];
+      }
+      mean[c] = columns.size() ? (double)sum / columns.size() : 0;
+      deviation[c] = columns.size() ? sqrt((double)squares / columns.size() - mean[c] * mean[c]) : 0;
+    }
+    evaluated += columns.size();
+  } while (secondsSince(start) < BENCH_MIN_SECONDS);
+  double evaluateSeconds = secondsSince(start);
+
+  printf("cursor     %10.2f M frames/s (%lu frames, %d passes, checksum %lld)\n", frames / cursorSeconds / 1e6,
+         frames / passes, passes, (long long)checksum);
+  printf("columns    %10.2f M frames/s\n", converted / convertSeconds / 1e6);
+  printf("mean, sd   %10.2f M frames/s over %d channels (%s %.1f +- %.1f)\n", evaluated / evaluateSeconds / 1e6,
+         CHANNEL_COUNT, channelName(0), mean[0], deviation[0]);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc == 3 && strcmp(argv[1], "info") == 0)
+  {
+    return info(argv[2]);
+  }
+  if (argc == 4 && strcmp(argv[1], "convert") == 0)
+  {
+    return convert(argv[2], argv[3]);
+  }
+  if (argc >= 2 && argc <= 3 && strcmp(argv[1], "bench") == 0)
+  {
+    return bench(argc, argv);
+  }
+  fprintf(stderr, "usage: records info <file.rec>\n"
+                  "       records convert <file.rec> <out.col>\n"
+                  "       records bench [file.rec | FRAMES]\n");
+  return 1;
+}
@@ -0,0 +1,118 @@
+// Where the time of a flex scan goes on the glove, for 5, 10 and 16 channels
+// wired straight to ADC pins or behind one or two multiplexers.
+//
+//   scansim [conversion_us] [imu_us]
+//
+// FlexScan.h runs against a model of the hardware: a conversion keeps the
+// ADC busy for conversion_us (analogRead() on the ESP32, 10 by default), a
+// multiplexer switch costs its four digitalWrite()s, and reading the IMUs
+// between two scans takes imu_us (one MPU6050 at 400 kHz, 400 by default).
+// For each wiring it prints the scan time, the share of it the ADC spends
+// converting, and the same scan done the simple way, switch, wait, convert,
+// one channel after the other.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "FlexScan.h"
+#include "../microbench/BenchGloves.h"
+
+#define SCANS 1000
+#define SELECT_NS 400 // Four digitalWrite()s of ~100 ns
+
+struct ModelIo
+{
+  uint64_t nowNs = 0;
+  uint64_t convertingNs = 0;
+  uint32_t conversionNs;
+
+  void select(int, int) { nowNs += SELECT_NS; }
+
+  int convert(int)
+  {
+    nowNs += conversionNs;
+    convertingNs += conversionNs;
+    return ADC_LEVELS / 2;
+  }
+
+  uint32_t nowUs() { return (uint32_t)(nowNs / 1000); }
+
+  void waitUntilUs(uint32_t time)
+  {
+    if ((uint64_t)time * 1000 > nowNs)
+    {
+      nowNs = (uint64_t)time * 1000;
+    }
+  }
+};
+
+struct ScanReport
+{
+  double scanUs;
+  double busyPercent;
+  double simpleUs;
+};
+
+// Switch, wait for the input to settle, convert, for every channel in order
+template <typename Profile>
+static double simpleScanUs(uint32_t conversionNs)
+{
+  if constexpr (Profile::muxCount > 0)
+  {
+    return Profile::flexCount * (SELECT_NS / 1000.0 + Profile::muxSettleUs + conversionNs / 1000.0);
+  }
+  return Profile::flexCount * conversionNs / 1000.0;
+}
+
+template <typename Profile>
+static ScanReport model(uint32_t conversionNs, uint32_t imuNs)
+{
+  ModelIo io;
+  io.conversionNs = conversionNs;
+  FlexScanner<Profile, ModelIo> scanner(io);
+  scanner.begin();
+  int raw[Profile::flexCount];
+  uint64_t scanningNs = 0;
+  for (int s = 0; s < SCANS; s++)
+  {
+    io.nowNs += imuNs; // IMUs are read first, the first input settles meanwhile
+    uint64_t start = io.nowNs;
+    scanner.scan(raw);
+    scanningNs += io.nowNs - start;
+  }
+
+  ScanReport report;
+  report.scanUs = scanningNs / 1000.0 / SCANS;
+  report.busyPercent = 100.0 * io.convertingNs / scanningNs;
+  report.simpleUs = simpleScanUs<Profile>(conversionNs);
+  return report;
+}
+
+template <typename Profile>
+static void print(const char *wiring, uint32_t conversionNs, uint32_t imuNs)
+{
+  ScanReport report = model<Profile>(conversionNs, imuNs);
+  printf("%s,%d,%d,%.1f,%.1f,%.1f\n", wiring, Profile::flexCount, Profile::muxCount, report.scanUs,
+         report.busyPercent, report.simpleUs);
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t conversionNs = (uint32_t)((argc > 1 ? atof(argv[1]) : 10.0) * 1000);
+  uint32_t imuNs = (uint32_t)((argc > 2 ? atof(argv[2]) : 400.0) * 1000);
+  if (conversionNs == 0)
+  {
+    fprintf(stderr, "usage: scansim [conversion_us] [imu_us]\n");
+    return 1;
+  }
+
+  printf("# %.1f us per conversion, %.1f us IMU read between scans, %d scans\n", conversionNs / 1000.0,
+         imuNs / 1000.0, SCANS);
+  printf("wiring,channels,muxes,scan_us,adc_busy_pct,simple_scan_us\n");
+  print<GloveProfile<GloveTDisplay5V>>("tdisplay-5v", conversionNs, imuNs);
+  print<GloveProfile<BenchGlove<5, 1>>>("mux", conversionNs, imuNs);
+  print<GloveProfile<BenchGlove<10, 1>>>("mux", conversionNs, imuNs);
+  print<GloveProfile<GloveAbduction>>("abduction", conversionNs, imuNs);
+  print<GloveProfile<BenchGlove<16, 1>>>("mux", conversionNs, imuNs);
+  print<GloveProfile<BenchGlove<16, 2>>>("mux", conversionNs, imuNs);
+  return 0;
+}
@@ -0,0 +1,110 @@
+// Synthetic glove traces (see GestureTrace.h) as files for the other tools.
+//
+//   tracegen <frames> <seed> <text> out.csv|out.rec [clean]
+//
+// Each frame goes through the firmware's conversion into the dataArray
+// layout. A .csv gets the capture time, the letter being held ('~' while
+// the hand moves between letters, '_' for the resting hand) and the 11 values
+// per line; a .rec is a recording in the glove's own format, as if
+// downloaded with bulkget. "clean" turns off noise, drift and dropouts.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GlovePipeline.h"
+#include "GloveCalibration.h"
+#include "GestureTrace.h"
+#include "RecordFormat.h"
+#include "RecordReader.h"
+
+static bool endsWith(const char *text, const char *suffix)
+{
+  size_t length = strlen(text);
+  size_t suffixLength = strlen(suffix);
+  return length >= suffixLength && strcmp(text + length - suffixLength, suffix) == 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 5 || argc > 6 || (argc == 6 && strcmp(argv[5], "clean") != 0))
+  {
+    fprintf(stderr, "usage: tracegen <frames> <seed> <text> out.csv|out.rec [clean]\n");
+    return 1;
+  }
+  unsigned long frames = strtoul(argv[1], NULL, 10);
+  bool rec = endsWith(argv[4], ".rec");
+  FILE *out = fopen(argv[4], rec ? "wb" : "w");
+  if (!out)
+  {
+    fprintf(stderr, "tracegen: cannot write %s\n", argv[4]);
+    return 1;
+  }
+
+  TraceConfig config = traceDefaults((uint32_t)strtoul(argv[2], NULL, 10), argv[3]);
+  if (argc == 6)
+  {
+    config.adcNoise = config.gyroNoise = config.accelNoise = 0;
+    config.adcDrift = config.gyroDrift = 0;
+    config.dropoutsPerMin = 0;
+  }
+  config.vcc = Glove::vcc;
+  config.rDiv = Glove::rDiv;
+  config.flatResistance = Glove::flatResistance;
+  config.bendResistance = Glove::bendResistance;
+  GestureTrace trace;
+  trace.begin(config);
+
+  uint8_t segment[RECORD_SEGMENT_SIZE];
+  SegmentWriter writer;
+  uint32_t sequence = 0;
+  writer.begin(segment, sequence);
+  if (!rec)
+  {
+    fprintf(out, "time_us,letter");
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+      fprintf(out, ",%s", channelName(i));
+    }
+    fputc('\n', out);
+  }
+
+  SensorSample sample;
+  int16_t dataArray[FRAME_VALUES];
+  for (unsigned long frame = 0; frame < frames; frame++)
+  {
+    trace.next(&sample);
+    Glove::flexAngles(sample.raw, dataArray);
+    traceImuToFrame(sample, dataArray);
+
+    if (rec)
+    {
+      if (!writer.add(dataArray, sample.timeUs))
+      {
+        writer.seal();
+        fwrite(segment, 1, sizeof(segment), out);
+        writer.begin(segment, ++sequence);
+        writer.add(dataArray, sample.timeUs);
+      }
+      continue;
+    }
+    fprintf(out, "%u,%c", sample.timeUs, !sample.holding ? '~' : (sample.letter == ' ' ? '_' : sample.letter));
+    for (int i = 0; i < FRAME_VALUES; i++)
+    {
+      fprintf(out, ",%d", dataArray[i]);
+    }
+    fputc('\n', out);
+  }
+  if (rec && writer.frameCount() > 0)
+  {
+    writer.seal();
+    fwrite(segment, 1, sizeof(segment), out);
+  }
+
+  if (fclose(out) != 0)
+  {
+    fprintf(stderr, "tracegen: cannot write %s\n", argv[4]);
+    return 1;
+  }
+  printf("%lu frames, %lu letters spelled, written to %s\n", frames, trace.lettersSpelled(), argv[4]);
+  return 0;
+}